@@ -1,8 +1,10 @@
 #pragma once
 
+#include <cstddef>
 #include <list>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "AbstractWrapper.h"
 #include "qps/evaluators/query_evaluator.hpp"
@@ -24,8 +26,6 @@ class TestWrapper : public AbstractWrapper {
     std::shared_ptr<qps::DefaultParser> qps_parser;
     std::shared_ptr<qps::QueryEvaluator> qps_evaluator;
 
-    auto load_file(const std::string& filename) -> std::string;
-
   public:
     TestWrapper();
 
@@ -34,4 +34,8 @@ class TestWrapper : public AbstractWrapper {
 
     // method for evaluating a query
     void evaluate(std::string query, std::list<std::string>& results) override;
+
+    // method for evaluating a batch of queries concurrently once the source is parsed; results keep the query order
+    auto evaluate_all(const std::vector<std::string>& queries, std::size_t num_threads)
+        -> std::vector<std::list<std::string>>;
 };
@@ -1,12 +1,11 @@
 #include "TestWrapper.h"
+#include "common/utils/thread_pool.hpp"
 #include "qps/parser/errors.hpp"
 #include "qps/template_utils.hpp"
 #include "sp/main.hpp"
 
 #include "qps/evaluators/query_evaluator.hpp"
 
-#include <filesystem>
-#include <fstream>
 #include <memory>
 #include <optional>
 #include <stdexcept>
@@ -30,34 +29,24 @@ TestWrapper::TestWrapper()
       qps_evaluator(nullptr) {
 
     auto [read_facade, write_facade] = pkb::PkbManager::create_facades();
+    write_facade->enable_next_star_index();
+    this->read_facade = read_facade;
+    this->write_facade = write_facade;
 
-    source_processor = sp::SourceProcessor::get_complete_sp(write_facade);
+    source_processor =
+        sp::SourceProcessor::get_complete_sp(write_facade, sp::TokenizerEngine::Combinator, sp::ExtractionMode::Parallel);
     qps_parser = std::make_shared<qps::DefaultParser>();
-    qps_evaluator = std::make_shared<qps::QueryEvaluator>(read_facade);
-}
-
-auto TestWrapper::load_file(const std::string& filename) -> std::string {
-    auto path = std::filesystem::path{filename};
-    if (!std::filesystem::exists(path)) {
-        throw std::runtime_error("Error: File does not exist");
-    }
-
-    std::ifstream file{path};
-
-    if (!file.is_open()) {
-        throw std::runtime_error("Error: Unable to open file");
-    }
-
-    return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    qps_evaluator = std::make_shared<qps::QueryEvaluator>(read_facade, std::thread::hardware_concurrency());
 }
 
 void TestWrapper::parse(std::string filename) {
-    auto input = load_file(filename);
-    auto ast = source_processor->process(input);
+    auto source = tokenizer::SourceFile{filename};
+    auto ast = source_processor->process(source);
 }
 
-void TestWrapper::evaluate(std::string query, std::list<std::string>& results) {
-    const auto output = qps_parser->parse(query);
+static void evaluate_query(const qps::DefaultParser& qps_parser, qps::QueryEvaluator& qps_evaluator,
+                           const std::string& query, std::list<std::string>& results) {
+    const auto output = qps_parser.parse(query);
     const auto maybe_query_obj =
         std::visit(qps::overloaded{[&results](const qps::SyntaxError& e) -> std::optional<qps::Query> {
                                        results.emplace_back("SyntaxError");
@@ -67,7 +56,7 @@ void TestWrapper::evaluate(std::string query, std::list<std::string>& results) {
                                        results.emplace_back("SemanticError");
                                        return std::nullopt;
                                    },
-                                   [&results, this](const qps::Query& query_obj) -> std::optional<qps::Query> {
+                                   [](const qps::Query& query_obj) -> std::optional<qps::Query> {
                                        return std::make_optional(query_obj);
                                    }},
                    output);
@@ -76,8 +65,31 @@ void TestWrapper::evaluate(std::string query, std::list<std::string>& results) {
     }
 
     const auto query_obj = maybe_query_obj.value();
-    const auto query_results = qps_evaluator->evaluate(query_obj);
+    const auto query_results = qps_evaluator.evaluate(query_obj);
     for (const auto& result : query_results) {
         results.emplace_back(result);
     }
 }
+
+void TestWrapper::evaluate(std::string query, std::list<std::string>& results) {
+    evaluate_query(*qps_parser, *qps_evaluator, query, results);
+}
+
+auto TestWrapper::evaluate_all(const std::vector<std::string>& queries, std::size_t num_threads)
+    -> std::vector<std::list<std::string>> {
+    auto results = std::vector<std::list<std::string>>(queries.size());
+    auto thread_pool = ThreadPool{num_threads};
+
+    // The PKB is read-only once parsed, so the workers share it but each keeps its own evaluator state
+    auto qps_evaluators = std::vector<qps::QueryEvaluator>{};
+    qps_evaluators.reserve(thread_pool.size());
+    for (std::size_t worker = 0; worker < thread_pool.size(); worker++) {
+        qps_evaluators.emplace_back(read_facade);
+    }
+
+    thread_pool.parallel_for(queries.size(), [this, &queries, &results, &qps_evaluators](std::size_t index,
+                                                                                          std::size_t worker) {
+        evaluate_query(*qps_parser, qps_evaluators[worker], queries[index], results[index]);
+    });
+    return results;
+}
@@ -1,4 +1,5 @@
 #include "AbstractWrapper.h"
+#include "TestWrapper.h"
 
 #include <algorithm>
 #include <chrono>
@@ -10,7 +11,7 @@
 #include <vector>
 
 auto message() -> std::string {
-    return "Usage: local_runner <source_path> <query_path>";
+    return "Usage: local_runner <source_path> [query_path] [num_threads]";
 }
 
 struct Query {
@@ -122,8 +123,40 @@ void measure_evaluation(const std::vector<Query>& query_objects, const std::uniq
     std::cout << "Min run: " << min_time << "[ms]" << std::endl;
 }
 
+void measure_parallel_evaluation(const std::vector<Query>& query_objects, const std::unique_ptr<AbstractWrapper>& wrapper,
+                                 std::size_t num_threads) {
+    auto* test_wrapper = dynamic_cast<TestWrapper*>(wrapper.get());
+    if (test_wrapper == nullptr) {
+        throw std::runtime_error("Error: Parallel evaluation needs a TestWrapper");
+    }
+
+    auto queries = std::vector<std::string>{};
+    queries.reserve(query_objects.size());
+    for (const auto& obj : query_objects) {
+        queries.push_back(obj.declarations + obj.query);
+    }
+
+    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    const auto all_results = test_wrapper->evaluate_all(queries, num_threads);
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+    for (std::size_t i = 0; i < query_objects.size(); i++) {
+        std::cout << "Query: " << query_objects[i].query_id << " - " << query_objects[i].comment << std::endl;
+        std::cout << "Expected: " << query_objects[i].expected_result << std::endl;
+        std::cout << "Result: ";
+        for (const auto& result : all_results[i]) {
+            std::cout << result << " ";
+        }
+        std::cout << std::endl << std::endl;
+    }
+
+    std::cout << "Threads: " << num_threads << std::endl;
+    std::cout << "Total run: " << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << "[ms]"
+              << std::endl;
+}
+
 auto main(int argc, char** argv) -> int {
-    if (argc != 2 && argc != 3) {
+    if (argc < 2 || argc > 4) {
         std::cerr << message() << std::endl;
         return 1;
     }
@@ -131,7 +164,7 @@ auto main(int argc, char** argv) -> int {
     const auto source_path = std::string{argv[1]};
     // Replace _source.txt with _queries.txt
     const auto query_path =
-        argc == 3 ? std::string{argv[2]} : source_path.substr(0, source_path.find_last_of('_')) + "_queries.txt";
+        argc >= 3 ? std::string{argv[2]} : source_path.substr(0, source_path.find_last_of('_')) + "_queries.txt";
 
     if (argc == 2) {
         std::cout << "Query deduced to be: " << query_path << std::endl;
@@ -144,5 +177,9 @@ auto main(int argc, char** argv) -> int {
 
     std::cout << "Evaluating queries..." << std::endl;
     const auto objs = read_query_file(query_path);
-    measure_evaluation(objs, wrapper);
+    if (argc == 4) {
+        measure_parallel_evaluation(objs, wrapper, std::stoul(argv[3]));
+    } else {
+        measure_evaluation(objs, wrapper);
+    }
 }
\ No newline at end of file
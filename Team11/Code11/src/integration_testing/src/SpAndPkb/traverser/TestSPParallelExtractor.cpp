@@ -0,0 +1,79 @@
+#include "catch.hpp"
+
+#include "pkb/facades/read_facade.h"
+#include "pkb/pkb_manager.h"
+#include "sp/main.hpp"
+
+TEST_CASE("Test Parallel Extraction - Matches Serial Extraction") {
+    const auto source = std::string{R"(
+        procedure main {
+            flag = 0;
+            call computeCentroid;
+            call printResults;
+        }
+
+        procedure readPoint {
+            read x;
+            read y;
+        }
+
+        procedure printResults {
+            print flag;
+            print cenX;
+            print cenY;
+            print normSq;
+        }
+
+        procedure computeCentroid {
+            count = 0;
+            cenX = 0;
+            cenY = 0;
+            call readPoint;
+            while ((x != 0) && (y != 0)) {
+                count = count + 1;
+                cenX = cenX + x;
+                cenY = cenY + y;
+                call readPoint;
+            }
+            if (count == 0) then {
+                flag = 1;
+            } else {
+                cenX = cenX / count;
+                cenY = cenY / count;
+            }
+            normSq = cenX * cenX + cenY * cenY;
+        })"};
+
+    auto [serial_read_facade, serial_write_facade] = pkb::PkbManager::create_facades();
+    auto serial_input = source;
+    sp::SourceProcessor::get_complete_sp(serial_write_facade)->process(serial_input);
+
+    auto [parallel_read_facade, parallel_write_facade] = pkb::PkbManager::create_facades();
+    auto parallel_input = source;
+    sp::SourceProcessor::get_complete_sp(parallel_write_facade, sp::TokenizerEngine::Combinator,
+                                         sp::ExtractionMode::Parallel)
+        ->process(parallel_input);
+
+    REQUIRE(parallel_read_facade->get_procedures() == serial_read_facade->get_procedures());
+    REQUIRE(parallel_read_facade->get_variables() == serial_read_facade->get_variables());
+    REQUIRE(parallel_read_facade->get_constants() == serial_read_facade->get_constants());
+    REQUIRE(parallel_read_facade->get_all_statements() == serial_read_facade->get_all_statements());
+    REQUIRE(parallel_read_facade->get_all_statements_and_var_modify_pairs() ==
+            serial_read_facade->get_all_statements_and_var_modify_pairs());
+    REQUIRE(parallel_read_facade->get_all_procedures_and_var_modify_pairs() ==
+            serial_read_facade->get_all_procedures_and_var_modify_pairs());
+    REQUIRE(parallel_read_facade->get_all_statements_and_var_use_pairs() ==
+            serial_read_facade->get_all_statements_and_var_use_pairs());
+    REQUIRE(parallel_read_facade->get_all_procedures_and_var_use_pairs() ==
+            serial_read_facade->get_all_procedures_and_var_use_pairs());
+    REQUIRE(parallel_read_facade->get_all_follows() == serial_read_facade->get_all_follows());
+    REQUIRE(parallel_read_facade->get_all_follows_star() == serial_read_facade->get_all_follows_star());
+    REQUIRE(parallel_read_facade->get_all_parent() == serial_read_facade->get_all_parent());
+    REQUIRE(parallel_read_facade->get_all_parent_star() == serial_read_facade->get_all_parent_star());
+    REQUIRE(parallel_read_facade->get_all_next() == serial_read_facade->get_all_next());
+    REQUIRE(parallel_read_facade->get_all_affects() == serial_read_facade->get_all_affects());
+    REQUIRE(parallel_read_facade->get_all_calls_star_keys() == serial_read_facade->get_all_calls_star_keys());
+    REQUIRE(parallel_read_facade->get_all_while_stmt_var_pairs() == serial_read_facade->get_all_while_stmt_var_pairs());
+    REQUIRE(parallel_read_facade->get_all_assignments_rhs_partial("cenX") ==
+            serial_read_facade->get_all_assignments_rhs_partial("cenX"));
+}
@@ -2,12 +2,15 @@
 
 #include "sp/main.hpp"
 
+#include "common/utils/thread_pool.hpp"
+
 #include "pkb/pkb_manager.h"
 
 #include "qps/evaluators/query_evaluator.hpp"
 #include "qps/parser.hpp"
 
 #include <unordered_set>
+#include <vector>
 
 using namespace pkb;
 
@@ -122,3 +125,53 @@ TEST_CASE("Test SPA - Entities") {
         }
     }
 }
+
+TEST_CASE("Test SPA - Concurrent queries") {
+    const auto queries = std::vector<std::string>{
+        "assign a1, a2; Select <a1, a2> such that Affects(a1, a2)",
+        "assign a; Select a such that Affects(_, a)",
+        "assign a; Select a pattern a(_, _\"cenX\"_)",
+        "assign a; variable v; Select <a, v> pattern a(v, _\"cenX * cenX\"_)",
+        "assign a; Select a pattern a(\"count\", \"count + 1\")",
+        "stmt s; Select s such that Next*(s, s)",
+    };
+    const auto qps_parser = qps::DefaultParser{};
+
+    auto evaluate_on_fresh_pkb = [&qps_parser, &queries](std::size_t num_threads) {
+        auto [read_facade, write_facade] = PkbManager::create_facades();
+        auto sp = sp::SourceProcessor::get_complete_sp(write_facade);
+        auto input = input_generator();
+        sp->process(input);
+
+        // Every query is evaluated several times so that workers hit the shared caches concurrently
+        constexpr auto num_repeats = std::size_t{8};
+        auto query_objs = std::vector<qps::Query>{};
+        for (const auto& query : queries) {
+            const auto maybe_query_obj = qps::to_query(qps_parser.parse(query));
+            REQUIRE(maybe_query_obj.has_value());
+            query_objs.push_back(maybe_query_obj.value());
+        }
+
+        auto results = std::vector<std::vector<std::string>>(queries.size() * num_repeats);
+        auto thread_pool = ThreadPool{num_threads};
+        auto evaluators = std::vector<qps::QueryEvaluator>{};
+        evaluators.reserve(thread_pool.size());
+        for (std::size_t worker = 0; worker < thread_pool.size(); worker++) {
+            evaluators.emplace_back(read_facade);
+        }
+        thread_pool.parallel_for(results.size(), [&](std::size_t index, std::size_t worker) {
+            results[index] = evaluators[worker].evaluate(query_objs[index % query_objs.size()]);
+        });
+        return results;
+    };
+
+    const auto sequential = evaluate_on_fresh_pkb(1);
+    const auto concurrent = evaluate_on_fresh_pkb(4);
+
+    REQUIRE(sequential.size() == concurrent.size());
+    for (std::size_t i = 0; i < sequential.size(); i++) {
+        const auto expected = std::unordered_set<std::string>(sequential[i].begin(), sequential[i].end());
+        require_overlap(concurrent[i], expected);
+    }
+    REQUIRE_FALSE(sequential[0].empty());
+}
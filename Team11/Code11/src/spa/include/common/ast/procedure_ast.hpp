@@ -17,6 +17,8 @@ class ProcedureNode : public AstNode, public DesignEntitiesMixin, public Modifie
                                         const std::shared_ptr<UsesMap>& uses_map,
                                         const std::shared_ptr<StatementListNode>& node)
         -> std::unordered_set<std::string>; // TODO: Move this function to a proper location, either public or private!
+    static auto store_proc_vars(std::unordered_map<std::string, std::unordered_set<std::string>>& map,
+                                const std::string& proc_name, const std::unordered_set<std::string>& vars) -> void;
 
   public:
     std::string proc_name;
@@ -1,23 +1,37 @@
 #pragma once
 
+#include "common/tokeniser/source_file.hpp"
 #include "common/tokeniser/tokenizer.hpp"
 
+#include <cstddef>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace tokenizer {
 class TokenizerRunner {
+    // Number of source bytes tokenized between releases of a SourceFile's consumed pages
+    static constexpr std::size_t SOURCE_CHUNK_SIZE = std::size_t{1} << 20;
+
     std::unique_ptr<Tokenizer> tokenizer;
 
     static void push_token(bool debug, std::vector<Token>& result, const Token& res_success);
     bool include_done;
 
+    [[nodiscard]] auto tokenize_all(std::string_view input, bool debug, SourceFile* source) const
+        -> std::vector<Token>;
+
   public:
     explicit TokenizerRunner(std::unique_ptr<Tokenizer> tokeniser, bool include_done = false)
         : tokenizer(std::move(tokeniser)), include_done(include_done) {
     }
 
-    [[nodiscard]] auto apply_tokeniser(std::string input, bool debug = false) const -> std::vector<Token>;
+    [[nodiscard]] auto apply_tokeniser(std::string_view input, bool debug = false) const -> std::vector<Token>;
+
+    /**
+     * @brief Tokenizes a mapped source file, releasing the consumed part of the mapping chunk by chunk.
+     */
+    [[nodiscard]] auto apply_tokeniser(SourceFile& source, bool debug = false) const -> std::vector<Token>;
 };
 } // namespace tokenizer
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace tokenizer {
+
+/**
+ * @class SourceFile
+ * @brief Read-only, memory-mapped view of a source file.
+ *
+ * The file is mapped instead of copied into a string, so the tokenizer reads it straight from the page cache. Parts
+ * of the mapping that have already been tokenized can be released, which keeps the resident size of the source
+ * bounded while a large file is tokenized. On platforms without mmap the file is read into memory instead.
+ */
+class SourceFile {
+    const char* data = nullptr;
+    std::size_t length = 0;
+    std::size_t released = 0;
+#ifdef _WIN32
+    std::string buffer;
+#endif
+
+  public:
+    explicit SourceFile(const std::string& filename);
+    ~SourceFile();
+
+    SourceFile(const SourceFile&) = delete;
+    auto operator=(const SourceFile&) -> SourceFile& = delete;
+    SourceFile(SourceFile&&) = delete;
+    auto operator=(SourceFile&&) -> SourceFile& = delete;
+
+    [[nodiscard]] auto view() const -> std::string_view;
+
+    /**
+     * @brief Releases the pages of the mapping before the given offset.
+     *
+     * The view stays valid, released pages are read back from the file if they are accessed again.
+     *
+     * @param offset The offset into the file up to which the source has been consumed.
+     */
+    void release_until(std::size_t offset);
+};
+} // namespace tokenizer
@@ -5,14 +5,18 @@
 #include <iostream>
 #include <iterator>
 #include <memory>
-#include <numeric>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <vector>
 
 namespace tokenizer {
-using TokeniserInput = std::string;
+/**
+ * Tokenizers read their input through a view, so consuming a token only advances the view over the underlying
+ * source instead of copying the remaining input.
+ */
+using TokeniserInput = std::string_view;
 
 /**
  * @brief Represents a token.
@@ -21,7 +25,7 @@ using TokeniserInput = std::string;
  */
 struct Token {
     TokenType T;
-    TokeniserInput content;
+    std::string content;
 
     /**
      * @brief Overloaded stream insertion operator for printing the token.
@@ -73,7 +77,7 @@ class Tokenizer {
      * @return An optional tuple containing the token and the remaining input, or an empty optional if the token is not
      * found.
      */
-    static auto tokenize_string(TokeniserInput input, std::string token, TokenType token_type) -> TokeniserOutput;
+    static auto tokenize_string(TokeniserInput input, std::string_view token, TokenType token_type) -> TokeniserOutput;
 
     template <typename Iterator>
     static auto one_of(const TokeniserInput& input, Iterator tokenisers_start, const Iterator& tokenisers_end)
@@ -119,8 +123,8 @@ auto Tokenizer::one_of(const TokeniserInput& input, Iterator tokenisers_start, c
 template <typename Iterator>
 auto Tokenizer::all_of(const TokeniserInput& input, Iterator tokenisers_start, const Iterator& tokenisers_end)
     -> TokeniserOutput {
-    auto successes = std::vector<Token>{};
     auto remaining_input = input;
+    auto token_type = std::optional<TokenType>{};
 
     for (auto it = tokenisers_start; it != tokenisers_end; it++) {
         const auto result = (*it)->tokenize(remaining_input);
@@ -128,17 +132,15 @@ auto Tokenizer::all_of(const TokeniserInput& input, Iterator tokenisers_start, c
             return std::nullopt;
         }
         const auto& [token, rest] = result.value();
-        successes.push_back(token);
-        remaining_input = std::get<1>(result.value());
+        if (!token_type.has_value()) {
+            token_type = token.T;
+        }
+        remaining_input = rest;
     }
 
-    const auto type_combinator = [](const Token& a, const Token& b) -> Token {
-        return Token{a.T, a.content + b.content};
-    };
-
-    const auto final_token =
-        std::accumulate(std::next(successes.begin()), successes.end(), successes[0], type_combinator);
-    return std::make_tuple(final_token, remaining_input);
+    // The matched tokens are contiguous, so the combined token is the consumed prefix of the input
+    const auto consumed = input.substr(0, input.length() - remaining_input.length());
+    return std::make_tuple(Token{token_type.value(), std::string{consumed}}, remaining_input);
 }
 
 } // namespace tokenizer
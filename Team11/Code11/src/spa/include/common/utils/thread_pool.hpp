@@ -0,0 +1,56 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * Fixed-size pool of worker threads that run indexed tasks in parallel.
+ *
+ * A task receives the index it should process and the id of the worker running it, so callers can keep one set of
+ * buffers per worker and fill them without locking.
+ */
+class ThreadPool {
+  public:
+    using Task = std::function<void(std::size_t index, std::size_t worker)>;
+
+    explicit ThreadPool(std::size_t num_threads = std::thread::hardware_concurrency());
+
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    auto operator=(const ThreadPool&) -> ThreadPool& = delete;
+    ThreadPool(ThreadPool&&) = delete;
+    auto operator=(ThreadPool&&) -> ThreadPool& = delete;
+
+    [[nodiscard]] auto size() const -> std::size_t;
+
+    /**
+     * Runs the task for every index in [0, count) on the pool and blocks until all of them are done. The first
+     * exception thrown by a task is rethrown here once the remaining tasks have finished.
+     */
+    void parallel_for(std::size_t count, const Task& task);
+
+  private:
+    std::vector<std::thread> workers;
+
+    std::mutex mutex;
+    std::condition_variable job_ready;
+    std::condition_variable job_done;
+
+    // The current job, guarded by the mutex except for the claimed index counter
+    const Task* task = nullptr;
+    std::size_t count = 0;
+    std::atomic<std::size_t> next_index{0};
+    std::size_t generation = 0;
+    std::size_t busy_workers = 0;
+    std::exception_ptr error;
+    bool stopping = false;
+
+    void work(std::size_t worker);
+};
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "pkb/common_types/symbol_id.h"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ * Read-only adjacency structure over symbol ids, used by the stores once the PKB has been finalised.
+ * The relation is kept in compressed sparse row form: the sorted, de-duplicated columns of every row are stored
+ * contiguously, and row i owns the range [offsets[i], offsets[i + 1]). Rows that are dense enough can additionally be
+ * indexed by a bitset, turning membership tests into a single bit probe.
+ */
+class IdAdjacency {
+  public:
+    using Edge = std::pair<SymbolId, SymbolId>;
+
+    IdAdjacency();
+
+    /**
+     * Builds the adjacency from a list of (row, column) edges. Duplicate edges are ignored.
+     *
+     * @param num_rows Number of rows; every row id in edges must be smaller than this.
+     * @param num_cols Number of columns; every column id in edges must be smaller than this.
+     * @param edges The edges of the relation.
+     * @param index_dense_rows Whether to build a bitset for rows whose bitset is no larger than their column list.
+     */
+    IdAdjacency(std::size_t num_rows, std::size_t num_cols, std::vector<Edge> edges, bool index_dense_rows = false);
+
+    [[nodiscard]] bool contains(SymbolId row, SymbolId col) const;
+
+    [[nodiscard]] bool has_row(SymbolId row) const;
+
+    [[nodiscard]] IdSpan get_row(SymbolId row) const;
+
+    [[nodiscard]] std::size_t get_num_rows() const;
+
+    [[nodiscard]] std::size_t get_num_edges() const;
+
+    [[nodiscard]] std::size_t get_num_dense_rows() const;
+
+  private:
+    using Word = std::uint64_t;
+    static constexpr std::size_t BITS_PER_WORD = 64;
+    static constexpr SymbolId NO_BITSET = INVALID_SYMBOL_ID;
+
+    std::vector<std::size_t> offsets;
+    std::vector<SymbolId> cols;
+
+    // Bitsets of the dense rows, each words_per_row long; bitset_of_row maps a row to its bitset or NO_BITSET
+    std::size_t words_per_row = 0;
+    std::vector<SymbolId> bitset_of_row;
+    std::vector<Word> bitsets;
+
+    void build_bitsets(std::size_t num_cols);
+};
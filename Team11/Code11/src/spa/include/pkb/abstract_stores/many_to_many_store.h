@@ -1,9 +1,15 @@
 #pragma once
 
 #include "common/hashable_tuple.h"
+#include "pkb/abstract_stores/id_adjacency.h"
+#include "pkb/common_types/set_view.h"
+#include "pkb/common_types/symbol_table.h"
 
+#include <memory>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
+#include <vector>
 
 template <class KeyType, class ValueType>
 class ManyToManyStore {
@@ -13,7 +19,15 @@ class ManyToManyStore {
     ManyToManyStore();
 
     void add(const KeyType& key, const ValueType& value);
+
+    /**
+     * Adds a whole relation at once. The pairs are set aside and go straight into the id-based representation when
+     * the store is frozen, where they are sorted and de-duplicated together, so bulk-loaded pairs never pay for the
+     * string-keyed maps. Reading the store before it is frozen moves the pending pairs into the maps first.
+     */
+    void add_all(std::vector<std::pair<KeyType, ValueType>> pairs);
     bool has_relationship() const;
+    std::size_t size() const;
     bool contains_key_val_pair(const KeyType& key, const ValueType& value) const;
     bool contains_key(const KeyType& key) const;
     bool contains_val(const ValueType& value) const;
@@ -25,9 +39,39 @@ class ManyToManyStore {
     std::unordered_set<KeyType> get_all_keys() const;
     std::unordered_set<ValueType> get_all_vals() const;
 
+    // Non-copying read operations, the views are invalidated by any write to the store
+    SetView<ValueType> view_vals_by_key(const KeyType& key) const;
+    SetView<KeyType> view_keys_by_val(const ValueType& value) const;
+
+    /**
+     * Moves the relation into an id-based representation and releases the string-keyed maps. Symbols that are
+     * missing from the symbol tables are interned. Adding to a frozen store thaws it again.
+     *
+     * @param index_dense_rows Whether dense rows should also be indexed by bitsets, which suits transitive closures.
+     */
+    void freeze(const std::shared_ptr<SymbolTable<KeyType>>& key_table,
+                const std::shared_ptr<SymbolTable<ValueType>>& value_table, bool index_dense_rows = false);
+    void thaw();
+    bool is_frozen() const;
+
+    // Id-based read operations, only valid while the store is frozen
+    bool contains_key_val_pair(SymbolId key, SymbolId value) const;
+    IdSpan get_vals_by_key(SymbolId key) const;
+    IdSpan get_keys_by_val(SymbolId value) const;
+
   private:
-    std::unordered_map<KeyType, std::unordered_set<ValueType>> forward_map;
-    std::unordered_map<ValueType, std::unordered_set<KeyType>> reverse_map;
+    // The maps are filled lazily from the pending pairs by const reads; they are never touched once frozen
+    mutable std::unordered_map<KeyType, std::unordered_set<ValueType>> forward_map;
+    mutable std::unordered_map<ValueType, std::unordered_set<KeyType>> reverse_map;
+    mutable std::vector<std::pair<KeyType, ValueType>> pending_pairs;
+
+    void flush_pending_pairs() const;
+
+    bool frozen = false;
+    std::shared_ptr<const SymbolTable<KeyType>> key_symbols;
+    std::shared_ptr<const SymbolTable<ValueType>> value_symbols;
+    IdAdjacency forward_ids;
+    IdAdjacency reverse_ids;
 };
 
 #include "many_to_many_store.tpp"
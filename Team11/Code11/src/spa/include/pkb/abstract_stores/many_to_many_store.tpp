@@ -7,33 +7,101 @@ ManyToManyStore<KeyType, ValueType>::ManyToManyStore() = default;
 
 template <class KeyType, class ValueType>
 void ManyToManyStore<KeyType, ValueType>::add(const KeyType& key, const ValueType& value) {
+    if (frozen) {
+        thaw();
+    }
     forward_map[key].insert(value);
     reverse_map[value].insert(key);
 }
 
+template <class KeyType, class ValueType>
+void ManyToManyStore<KeyType, ValueType>::add_all(std::vector<std::pair<KeyType, ValueType>> pairs) {
+    if (pairs.empty()) {
+        return;
+    }
+    if (frozen) {
+        thaw();
+    }
+    if (pending_pairs.empty()) {
+        pending_pairs = std::move(pairs);
+        return;
+    }
+    pending_pairs.insert(pending_pairs.end(), std::make_move_iterator(pairs.begin()),
+                         std::make_move_iterator(pairs.end()));
+}
+
+template <class KeyType, class ValueType>
+void ManyToManyStore<KeyType, ValueType>::flush_pending_pairs() const {
+    if (pending_pairs.empty()) {
+        return;
+    }
+    for (const auto& [key, value] : pending_pairs) {
+        forward_map[key].insert(value);
+        reverse_map[value].insert(key);
+    }
+    pending_pairs = {};
+}
+
 template <class KeyType, class ValueType>
 bool ManyToManyStore<KeyType, ValueType>::has_relationship() const {
+    flush_pending_pairs();
+    if (frozen) {
+        return forward_ids.get_num_edges() > 0;
+    }
     return !forward_map.empty();
 }
 
+template <class KeyType, class ValueType>
+std::size_t ManyToManyStore<KeyType, ValueType>::size() const {
+    flush_pending_pairs();
+    if (frozen) {
+        return forward_ids.get_num_edges();
+    }
+    std::size_t num_pairs = 0;
+    for (const auto& [key, values] : forward_map) {
+        num_pairs += values.size();
+    }
+    return num_pairs;
+}
+
 template <class KeyType, class ValueType>
 bool ManyToManyStore<KeyType, ValueType>::contains_key_val_pair(const KeyType& key, const ValueType& value) const {
+    flush_pending_pairs();
+    if (frozen) {
+        return contains_key_val_pair(key_symbols->get_id(key), value_symbols->get_id(value));
+    }
     auto it = forward_map.find(key);
     return it != forward_map.end() && it->second.find(value) != it->second.end();
 }
 
 template <class KeyType, class ValueType>
 bool ManyToManyStore<KeyType, ValueType>::contains_key(const KeyType& key) const {
+    flush_pending_pairs();
+    if (frozen) {
+        return forward_ids.has_row(key_symbols->get_id(key));
+    }
     return forward_map.find(key) != forward_map.end();
 }
 
 template <class KeyType, class ValueType>
 bool ManyToManyStore<KeyType, ValueType>::contains_val(const ValueType& value) const {
+    flush_pending_pairs();
+    if (frozen) {
+        return reverse_ids.has_row(value_symbols->get_id(value));
+    }
     return reverse_map.find(value) != reverse_map.end();
 }
 
 template <class KeyType, class ValueType>
 std::unordered_set<ValueType> ManyToManyStore<KeyType, ValueType>::get_vals_by_key(const KeyType& key) const {
+    flush_pending_pairs();
+    if (frozen) {
+        std::unordered_set<ValueType> values;
+        for (auto id : get_vals_by_key(key_symbols->get_id(key))) {
+            values.insert(value_symbols->get_symbol(id));
+        }
+        return values;
+    }
     if (forward_map.find(key) != forward_map.end()) {
         return forward_map.at(key);
     }
@@ -42,6 +110,14 @@ std::unordered_set<ValueType> ManyToManyStore<KeyType, ValueType>::get_vals_by_k
 
 template <class KeyType, class ValueType>
 std::unordered_set<KeyType> ManyToManyStore<KeyType, ValueType>::get_keys_by_val(const ValueType& value) const {
+    flush_pending_pairs();
+    if (frozen) {
+        std::unordered_set<KeyType> keys;
+        for (auto id : get_keys_by_val(value_symbols->get_id(value))) {
+            keys.insert(key_symbols->get_symbol(id));
+        }
+        return keys;
+    }
     if (reverse_map.find(value) != reverse_map.end()) {
         return reverse_map.at(value);
     }
@@ -50,19 +126,49 @@ std::unordered_set<KeyType> ManyToManyStore<KeyType, ValueType>::get_keys_by_val
 
 template <class KeyType, class ValueType>
 std::unordered_map<KeyType, std::unordered_set<ValueType>> ManyToManyStore<KeyType, ValueType>::get_all() const {
+    flush_pending_pairs();
+    if (frozen) {
+        std::unordered_map<KeyType, std::unordered_set<ValueType>> all;
+        for (SymbolId key = 0; key < forward_ids.get_num_rows(); key++) {
+            for (auto value : forward_ids.get_row(key)) {
+                all[key_symbols->get_symbol(key)].insert(value_symbols->get_symbol(value));
+            }
+        }
+        return all;
+    }
     return forward_map;
 }
 
 template <class KeyType, class ValueType>
 std::unordered_map<ValueType, std::unordered_set<KeyType>>
 ManyToManyStore<KeyType, ValueType>::get_all_reverse() const {
+    flush_pending_pairs();
+    if (frozen) {
+        std::unordered_map<ValueType, std::unordered_set<KeyType>> all;
+        for (SymbolId value = 0; value < reverse_ids.get_num_rows(); value++) {
+            for (auto key : reverse_ids.get_row(value)) {
+                all[value_symbols->get_symbol(value)].insert(key_symbols->get_symbol(key));
+            }
+        }
+        return all;
+    }
     return reverse_map;
 }
 
 template <class KeyType, class ValueType>
 std::unordered_set<std::tuple<KeyType, ValueType>> ManyToManyStore<KeyType, ValueType>::get_all_pairs() const {
+    flush_pending_pairs();
     std::unordered_set<std::tuple<KeyType, ValueType>> allPairs;
 
+    if (frozen) {
+        for (SymbolId key = 0; key < forward_ids.get_num_rows(); key++) {
+            for (auto value : forward_ids.get_row(key)) {
+                allPairs.insert(std::make_tuple(key_symbols->get_symbol(key), value_symbols->get_symbol(value)));
+            }
+        }
+        return allPairs;
+    }
+
     for (const auto& [key, val] : forward_map) {
         for (const auto& v : val) {
             allPairs.insert(std::make_tuple(key, v));
@@ -74,7 +180,16 @@ std::unordered_set<std::tuple<KeyType, ValueType>> ManyToManyStore<KeyType, Valu
 
 template <class KeyType, class ValueType>
 std::unordered_set<KeyType> ManyToManyStore<KeyType, ValueType>::get_all_keys() const {
+    flush_pending_pairs();
     std::unordered_set<KeyType> keys;
+    if (frozen) {
+        for (SymbolId key = 0; key < forward_ids.get_num_rows(); key++) {
+            if (forward_ids.has_row(key)) {
+                keys.insert(key_symbols->get_symbol(key));
+            }
+        }
+        return keys;
+    }
     for (const auto& pair : forward_map) {
         keys.insert(pair.first);
     }
@@ -83,9 +198,119 @@ std::unordered_set<KeyType> ManyToManyStore<KeyType, ValueType>::get_all_keys()
 
 template <class KeyType, class ValueType>
 std::unordered_set<ValueType> ManyToManyStore<KeyType, ValueType>::get_all_vals() const {
+    flush_pending_pairs();
     std::unordered_set<ValueType> values;
+    if (frozen) {
+        for (SymbolId value = 0; value < reverse_ids.get_num_rows(); value++) {
+            if (reverse_ids.has_row(value)) {
+                values.insert(value_symbols->get_symbol(value));
+            }
+        }
+        return values;
+    }
     for (const auto& pair : reverse_map) {
         values.insert(pair.first);
     }
     return values;
-}
\ No newline at end of file
+}
+
+template <class KeyType, class ValueType>
+SetView<ValueType> ManyToManyStore<KeyType, ValueType>::view_vals_by_key(const KeyType& key) const {
+    flush_pending_pairs();
+    if (frozen) {
+        return {get_vals_by_key(key_symbols->get_id(key)), value_symbols.get()};
+    }
+    auto it = forward_map.find(key);
+    return it != forward_map.end() ? SetView<ValueType>{&it->second} : SetView<ValueType>{};
+}
+
+template <class KeyType, class ValueType>
+SetView<KeyType> ManyToManyStore<KeyType, ValueType>::view_keys_by_val(const ValueType& value) const {
+    flush_pending_pairs();
+    if (frozen) {
+        return {get_keys_by_val(value_symbols->get_id(value)), key_symbols.get()};
+    }
+    auto it = reverse_map.find(value);
+    return it != reverse_map.end() ? SetView<KeyType>{&it->second} : SetView<KeyType>{};
+}
+
+template <class KeyType, class ValueType>
+void ManyToManyStore<KeyType, ValueType>::freeze(const std::shared_ptr<SymbolTable<KeyType>>& key_table,
+                                                 const std::shared_ptr<SymbolTable<ValueType>>& value_table,
+                                                 bool index_dense_rows) {
+    if (frozen) {
+        thaw();
+    }
+
+    std::vector<IdAdjacency::Edge> forward_edges;
+    std::vector<IdAdjacency::Edge> reverse_edges;
+    forward_edges.reserve(pending_pairs.size());
+    reverse_edges.reserve(pending_pairs.size());
+    for (const auto& [key, value] : pending_pairs) {
+        auto key_id = key_table->intern(key);
+        auto value_id = value_table->intern(value);
+        forward_edges.emplace_back(key_id, value_id);
+        reverse_edges.emplace_back(value_id, key_id);
+    }
+    for (const auto& [key, values] : forward_map) {
+        auto key_id = key_table->intern(key);
+        for (const auto& value : values) {
+            auto value_id = value_table->intern(value);
+            forward_edges.emplace_back(key_id, value_id);
+            reverse_edges.emplace_back(value_id, key_id);
+        }
+    }
+
+    // Sized by the tables at this point; ids interned later are simply treated as unrelated
+    forward_ids = IdAdjacency(key_table->size(), value_table->size(), std::move(forward_edges), index_dense_rows);
+    reverse_ids = IdAdjacency(value_table->size(), key_table->size(), std::move(reverse_edges), index_dense_rows);
+    key_symbols = key_table;
+    value_symbols = value_table;
+
+    forward_map = {};
+    reverse_map = {};
+    pending_pairs = {};
+    frozen = true;
+}
+
+template <class KeyType, class ValueType>
+void ManyToManyStore<KeyType, ValueType>::thaw() {
+    if (!frozen) {
+        return;
+    }
+
+    for (SymbolId key = 0; key < forward_ids.get_num_rows(); key++) {
+        for (auto value : forward_ids.get_row(key)) {
+            const auto& key_symbol = key_symbols->get_symbol(key);
+            const auto& value_symbol = value_symbols->get_symbol(value);
+            forward_map[key_symbol].insert(value_symbol);
+            reverse_map[value_symbol].insert(key_symbol);
+        }
+    }
+
+    forward_ids = {};
+    reverse_ids = {};
+    key_symbols = nullptr;
+    value_symbols = nullptr;
+    frozen = false;
+}
+
+template <class KeyType, class ValueType>
+bool ManyToManyStore<KeyType, ValueType>::is_frozen() const {
+    return frozen;
+}
+
+template <class KeyType, class ValueType>
+bool ManyToManyStore<KeyType, ValueType>::contains_key_val_pair(SymbolId key, SymbolId value) const {
+    return forward_ids.contains(key, value);
+}
+
+template <class KeyType, class ValueType>
+IdSpan ManyToManyStore<KeyType, ValueType>::get_vals_by_key(SymbolId key) const {
+    return forward_ids.get_row(key);
+}
+
+template <class KeyType, class ValueType>
+IdSpan ManyToManyStore<KeyType, ValueType>::get_keys_by_val(SymbolId value) const {
+    return reverse_ids.get_row(value);
+}
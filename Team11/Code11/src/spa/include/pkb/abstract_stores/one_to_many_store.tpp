@@ -16,6 +16,11 @@ bool OneToManyStore<KeyType, ValueType>::has_relationship() const {
     return !forward_map.empty();
 }
 
+template <class KeyType, class ValueType>
+std::size_t OneToManyStore<KeyType, ValueType>::size() const {
+    return reverse_map.size();
+}
+
 template <class KeyType, class ValueType>
 bool OneToManyStore<KeyType, ValueType>::contains_key_val_pair(const KeyType& key, const ValueType& value) const {
     auto it = forward_map.find(key);
@@ -14,6 +14,7 @@ class OneToOneStore {
 
     void add(const KeyType& key, const ValueType& value);
     bool has_relationship() const;
+    std::size_t size() const;
     bool contains_key_val_pair(const KeyType& key, const ValueType& value) const;
     bool contains_key(const KeyType& key) const;
     bool contains_val(const ValueType& value) const;
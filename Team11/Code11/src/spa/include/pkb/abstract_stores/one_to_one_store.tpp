@@ -16,6 +16,11 @@ bool OneToOneStore<KeyType, ValueType>::has_relationship() const {
     return !forward_map.empty();
 }
 
+template <class KeyType, class ValueType>
+std::size_t OneToOneStore<KeyType, ValueType>::size() const {
+    return forward_map.size();
+}
+
 template <typename KeyType, typename ValueType>
 bool OneToOneStore<KeyType, ValueType>::contains_key_val_pair(const KeyType& key, const ValueType& value) const {
     auto it = forward_map.find(key);
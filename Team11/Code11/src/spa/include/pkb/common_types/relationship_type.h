@@ -0,0 +1,16 @@
+#pragma once
+
+// Relationships that are stored in the PKB, as opposed to Next* and Affects which are computed on demand
+enum class RelationshipType {
+    Follows,
+    FollowsStar,
+    Parent,
+    ParentStar,
+    UsesS,
+    UsesP,
+    ModifiesS,
+    ModifiesP,
+    Next,
+    Calls,
+    CallsStar,
+};
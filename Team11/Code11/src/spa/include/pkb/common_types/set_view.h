@@ -0,0 +1,105 @@
+#pragma once
+
+#include "pkb/common_types/symbol_id.h"
+#include "pkb/common_types/symbol_table.h"
+
+#include <cstddef>
+#include <iterator>
+#include <unordered_set>
+
+/**
+ * Non-owning, read-only view over a set of symbols held by a store. The view either refers to a set in the store's
+ * string-keyed maps, or to a row of ids in a frozen store together with the symbol table to resolve them against.
+ * A view is invalidated by any write to the store it was obtained from.
+ */
+template <class T>
+class SetView {
+  public:
+    class Iterator {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        Iterator() = default;
+
+        explicit Iterator(typename std::unordered_set<T>::const_iterator set_it) : set_it(set_it) {
+        }
+
+        Iterator(const SymbolId* id_it, const SymbolTable<T>* symbols) : id_it(id_it), symbols(symbols) {
+        }
+
+        reference operator*() const {
+            return symbols != nullptr ? symbols->get_symbol(*id_it) : *set_it;
+        }
+
+        pointer operator->() const {
+            return &**this;
+        }
+
+        Iterator& operator++() {
+            if (symbols != nullptr) {
+                ++id_it;
+            } else {
+                ++set_it;
+            }
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            auto old = *this;
+            ++*this;
+            return old;
+        }
+
+        bool operator==(const Iterator& other) const {
+            return id_it == other.id_it && set_it == other.set_it;
+        }
+
+        bool operator!=(const Iterator& other) const {
+            return !(*this == other);
+        }
+
+      private:
+        typename std::unordered_set<T>::const_iterator set_it{};
+        const SymbolId* id_it = nullptr;
+        const SymbolTable<T>* symbols = nullptr;
+    };
+
+    SetView() = default;
+
+    explicit SetView(const std::unordered_set<T>* set) : set(set) {
+    }
+
+    SetView(IdSpan ids, const SymbolTable<T>* symbols) : ids(ids), symbols(symbols) {
+    }
+
+    [[nodiscard]] Iterator begin() const {
+        if (set != nullptr) {
+            return Iterator{set->cbegin()};
+        }
+        return symbols != nullptr ? Iterator{ids.begin(), symbols} : Iterator{};
+    }
+
+    [[nodiscard]] Iterator end() const {
+        if (set != nullptr) {
+            return Iterator{set->cend()};
+        }
+        return symbols != nullptr ? Iterator{ids.end(), symbols} : Iterator{};
+    }
+
+    [[nodiscard]] std::size_t size() const {
+        return set != nullptr ? set->size() : ids.size();
+    }
+
+    [[nodiscard]] bool empty() const {
+        return size() == 0;
+    }
+
+  private:
+    const std::unordered_set<T>* set = nullptr;
+    IdSpan ids;
+    const SymbolTable<T>* symbols = nullptr;
+};
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+using SymbolId = std::uint32_t;
+
+static constexpr SymbolId INVALID_SYMBOL_ID = std::numeric_limits<SymbolId>::max();
+
+/**
+ * Non-owning view over a contiguous range of symbol ids.
+ */
+class IdSpan {
+  public:
+    IdSpan() = default;
+
+    IdSpan(const SymbolId* first, const SymbolId* last) : first(first), last(last) {
+    }
+
+    [[nodiscard]] const SymbolId* begin() const {
+        return first;
+    }
+
+    [[nodiscard]] const SymbolId* end() const {
+        return last;
+    }
+
+    [[nodiscard]] std::size_t size() const {
+        return static_cast<std::size_t>(last - first);
+    }
+
+    [[nodiscard]] bool empty() const {
+        return first == last;
+    }
+
+  private:
+    const SymbolId* first = nullptr;
+    const SymbolId* last = nullptr;
+};
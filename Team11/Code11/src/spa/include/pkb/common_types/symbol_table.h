@@ -0,0 +1,45 @@
+#pragma once
+
+#include "pkb/common_types/symbol_id.h"
+
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Class to assign dense integer ids to the symbols (statement numbers, variables, procedures, constants) of a SIMPLE
+ * program. Ids are handed out in insertion order, starting from 0.
+ */
+template <class T>
+class SymbolTable {
+  public:
+    SymbolTable();
+
+    /**
+     * Returns the id of the symbol, assigning a new id if the symbol has not been seen before.
+     */
+    SymbolId intern(const T& symbol);
+
+    /**
+     * Returns the id of the symbol, or INVALID_SYMBOL_ID if the symbol is not in the table.
+     */
+    [[nodiscard]] SymbolId get_id(const T& symbol) const;
+
+    [[nodiscard]] bool contains(const T& symbol) const;
+
+    /**
+     * Returns the symbol with the given id. The id must have been handed out by this table.
+     */
+    [[nodiscard]] const T& get_symbol(SymbolId id) const;
+
+    [[nodiscard]] const std::vector<T>& get_symbols() const;
+
+    [[nodiscard]] std::size_t size() const;
+
+    void clear();
+
+  private:
+    std::unordered_map<T, SymbolId> symbol_to_id;
+    std::vector<T> id_to_symbol;
+};
+
+#include "symbol_table.tpp"
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "symbol_table.h"
+
+template <class T>
+SymbolTable<T>::SymbolTable() = default;
+
+template <class T>
+SymbolId SymbolTable<T>::intern(const T& symbol) {
+    auto [it, is_new] = symbol_to_id.try_emplace(symbol, static_cast<SymbolId>(id_to_symbol.size()));
+    if (is_new) {
+        id_to_symbol.push_back(symbol);
+    }
+    return it->second;
+}
+
+template <class T>
+SymbolId SymbolTable<T>::get_id(const T& symbol) const {
+    auto it = symbol_to_id.find(symbol);
+    return it != symbol_to_id.end() ? it->second : INVALID_SYMBOL_ID;
+}
+
+template <class T>
+bool SymbolTable<T>::contains(const T& symbol) const {
+    return symbol_to_id.find(symbol) != symbol_to_id.end();
+}
+
+template <class T>
+const T& SymbolTable<T>::get_symbol(SymbolId id) const {
+    return id_to_symbol[id];
+}
+
+template <class T>
+const std::vector<T>& SymbolTable<T>::get_symbols() const {
+    return id_to_symbol;
+}
+
+template <class T>
+std::size_t SymbolTable<T>::size() const {
+    return id_to_symbol.size();
+}
+
+template <class T>
+void SymbolTable<T>::clear() {
+    symbol_to_id.clear();
+    id_to_symbol.clear();
+}
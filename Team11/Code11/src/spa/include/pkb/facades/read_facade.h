@@ -10,6 +10,10 @@
 #include <unordered_set>
 
 namespace pkb {
+/**
+ * Read access to the PKB. Once the PKB is finalised nothing but its internal caches changes, and those are
+ * synchronised, so one ReadFacade can be shared by query evaluators running on different threads.
+ */
 class ReadFacade {
   public:
     explicit ReadFacade(std::shared_ptr<PkbManager> pkb);
@@ -60,6 +64,30 @@ class ReadFacade {
 
     bool has_call_statement(const std::string& s) const;
 
+    // Symbol table-related Read Operations
+    bool is_finalised() const;
+
+    SymbolId get_statement_id(const std::string& statement_number) const;
+
+    std::string get_statement_by_id(SymbolId id) const;
+
+    SymbolId get_variable_id(const std::string& variable) const;
+
+    std::string get_variable_by_id(SymbolId id) const;
+
+    SymbolId get_procedure_id(const std::string& procedure) const;
+
+    std::string get_procedure_by_id(SymbolId id) const;
+
+    SymbolId get_constant_id(const std::string& constant) const;
+
+    std::string get_constant_by_id(SymbolId id) const;
+
+    bool has_statement_type(SymbolId id, StatementType statement_type) const;
+
+    // The varName of a read or print statement or the procName of a call statement, and empty for other statements
+    std::string get_statement_name_attribute(const std::string& s) const;
+
     // Modifies-related Read Operations
     std::unordered_set<std::string> get_vars_modified_by_statement(const std::string& s) const;
 
@@ -197,6 +225,10 @@ class ReadFacade {
     std::unordered_set<std::string> get_follows_stars_by(const std::string& stmt,
                                                          const StatementType& statement_type) const;
 
+    SetView<std::string> view_follows_stars_following(const std::string& stmt) const;
+
+    SetView<std::string> view_follows_stars_by(const std::string& stmt) const;
+
     // Parent-related Read Operations
     bool has_parent_relation() const;
 
@@ -253,6 +285,10 @@ class ReadFacade {
     std::unordered_set<std::string> get_parent_star_of(const std::string& child,
                                                        const StatementType& statement_type) const;
 
+    SetView<std::string> view_children_star_of(const std::string& parent) const;
+
+    SetView<std::string> view_parent_star_of(const std::string& child) const;
+
     // Next-related Read Operations
     bool has_next_relation() const;
 
@@ -274,6 +310,28 @@ class ReadFacade {
 
     std::unordered_map<std::string, std::unordered_set<std::string>> get_all_next_reverse() const;
 
+    SetView<std::string> view_next_of(const std::string& before) const;
+
+    SetView<std::string> view_previous_of(const std::string& after) const;
+
+    // Next*-related Read Operations, only available once the PKB is finalised with the Next* index enabled
+    bool has_next_star_index() const;
+
+    bool has_next_star_relation(const std::string& before, const std::string& after) const;
+
+    std::unordered_set<std::string> get_next_star_of(const std::string& before) const;
+
+    std::unordered_set<std::string> get_previous_star_of(const std::string& after) const;
+
+    // Affects-related Read Operations, memoised until the next write to the PKB
+    bool has_affects_relation(const std::string& stmt1, const std::string& stmt2) const;
+
+    SetView<std::string> view_affected_by(const std::string& stmt) const;
+
+    SetView<std::string> view_affecting(const std::string& stmt) const;
+
+    const std::unordered_map<std::string, std::unordered_set<std::string>>& get_all_affects() const;
+
     // Calls-related Read Operations
     bool has_calls_relation() const;
 
@@ -352,6 +410,27 @@ class ReadFacade {
 
     bool are_stmt_nos_in_same_proc(const std::string& stmt_no_1, const std::string& stmt_no_2) const;
 
+    // Hit and miss counts of the assignment pattern match cache; the hook is called after every cache lookup
+    PatternMatchCache::Statistics get_pattern_match_cache_statistics() const;
+
+    void set_pattern_match_cache_hook(PatternMatchCache::Hook hook);
+
+    // Cardinalities for query planning, read without materialising the stores. The catalog is only filled in once the
+    // PKB is finalised, and the counts below fall back to scanning the stores before that.
+    const StatisticsCatalog& get_statistics() const;
+
+    std::size_t get_relationship_size(RelationshipType relationship_type) const;
+
+    std::size_t get_statement_count() const;
+
+    std::size_t get_statement_count(StatementType statement_type) const;
+
+    std::size_t get_procedure_count() const;
+
+    std::size_t get_variable_count() const;
+
+    std::size_t get_constant_count() const;
+
   private:
     std::shared_ptr<PkbManager> pkb;
 };
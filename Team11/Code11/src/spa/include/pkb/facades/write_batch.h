@@ -0,0 +1,36 @@
+#pragma once
+
+#include "common/statement_type.hpp"
+
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace pkb {
+/**
+ * Writes recorded by a batched WriteFacade, kept until the batch is committed to the PKB.
+ */
+struct WriteBatch {
+    using Pair = std::pair<std::string, std::string>;
+    using Pairs = std::vector<Pair>;
+
+    std::vector<std::string> procedures;
+    std::vector<std::string> variables;
+    std::vector<std::string> constants;
+    std::vector<std::pair<std::string, StatementType>> statements;
+    Pairs statement_modifies;
+    Pairs procedure_modifies;
+    Pairs statement_uses;
+    Pairs procedure_uses;
+    Pairs follows;
+    Pairs parents;
+    std::vector<std::tuple<std::string, std::string, std::string>> assignments;
+    Pairs if_vars;
+    Pairs while_vars;
+    Pairs nexts;
+    Pairs calls;
+    Pairs stmt_no_proc_called;
+    Pairs proc_to_stmt_no;
+};
+} // namespace pkb
@@ -5,7 +5,9 @@
 #include "pkb/common_types/entity.h"
 #include "pkb/common_types/procedure.h"
 #include "pkb/common_types/variable.h"
+#include "pkb/facades/write_batch.h"
 #include "pkb/pkb_manager.h"
+#include <memory>
 #include <unordered_set>
 #include <vector>
 
@@ -50,9 +52,47 @@ class WriteFacade {
 
     void add_proc_to_stmt_no_mapping(const std::string& procedure, const std::string& stmt_no);
 
+    /**
+     * Bulk variants of the relationship writes, taking every pair of a relation at once. The PKB sorts, de-duplicates
+     * and indexes the pairs in one pass when it is finalised instead of inserting them one by one.
+     */
+    void add_all_statement_modify_vars(WriteBatch::Pairs statement_variable_pairs);
+
+    void add_all_procedure_modify_vars(WriteBatch::Pairs procedure_variable_pairs);
+
+    void add_all_statement_use_vars(WriteBatch::Pairs statement_variable_pairs);
+
+    void add_all_procedure_use_vars(WriteBatch::Pairs procedure_variable_pairs);
+
+    void add_all_nexts(WriteBatch::Pairs stmt_pairs);
+
+    void add_all_calls(WriteBatch::Pairs caller_callee_pairs);
+
+    void add_all_if_vars(WriteBatch::Pairs statement_variable_pairs);
+
+    void add_all_while_vars(WriteBatch::Pairs statement_variable_pairs);
+
+    /**
+     * Precompute the Next* closure when the PKB is finalised, trading load time and memory for O(1) Next* lookups.
+     */
+    void enable_next_star_index();
+
     void finalise_pkb(const std::vector<std::string>& procedure_order = {});
 
+    /**
+     * Creates a facade that records its writes into a batch instead of writing to the PKB. A batched facade is not
+     * thread safe, but separate batches can be filled concurrently and committed afterwards.
+     */
+    [[nodiscard]] std::shared_ptr<WriteFacade> create_batch() const;
+
+    /**
+     * Applies the writes recorded by a batched facade to the PKB and empties its batch. Relationships are handed over
+     * through the bulk writes.
+     */
+    void commit(WriteFacade& batched);
+
   private:
     std::shared_ptr<PkbManager> pkb;
+    std::shared_ptr<WriteBatch> batch;
 };
 } // namespace pkb
\ No newline at end of file
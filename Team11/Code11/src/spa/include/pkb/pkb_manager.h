@@ -1,6 +1,10 @@
 #pragma once
 
 #include "common/hashable_tuple.h"
+#include "pkb/common_types/relationship_type.h"
+#include "pkb/common_types/set_view.h"
+#include "pkb/common_types/symbol_table.h"
+#include "pkb/stores/affects_cache.h"
 #include "pkb/stores/calls_store/calls_star_store.h"
 #include "pkb/stores/calls_store/direct_calls_store.h"
 #include "pkb/stores/calls_store/stmt_no_to_proc_called_store.h"
@@ -9,18 +13,23 @@
 #include "pkb/stores/follows_store/follows_star_store.h"
 #include "pkb/stores/modifies_store/procedure_modifies_store.h"
 #include "pkb/stores/modifies_store/statement_modifies_store.h"
+#include "pkb/stores/next_star_index.h"
 #include "pkb/stores/next_store.h"
 #include "pkb/stores/parent_store/direct_parent_store.h"
 #include "pkb/stores/parent_store/parent_star_store.h"
+#include "pkb/stores/pattern_match_cache.h"
 #include "pkb/stores/pattern_matching_store/assignment_store.h"
 #include "pkb/stores/pattern_matching_store/if_var_store.h"
 #include "pkb/stores/pattern_matching_store/while_var_store.h"
 #include "pkb/stores/proc_to_stmt_nos_store.h"
 #include "pkb/stores/statement_store.h"
+#include "pkb/stores/statistics_catalog.h"
 #include "pkb/stores/uses_store/procedure_uses_store.h"
 #include "pkb/stores/uses_store/statement_uses_store.h"
 #include <memory>
 #include <tuple>
+#include <utility>
+#include <vector>
 
 // Forward declaration of facades
 namespace pkb {
@@ -44,7 +53,7 @@ class PkbManager {
                                                    Extractor extractor) const {
         std::unordered_set<T> filtered;
         for (const auto& elem : set) {
-            if (statement_store->get_val_by_key(extractor(elem)) == statement_type) {
+            if (get_statement_type(extractor(elem)) == statement_type) {
                 filtered.insert(elem);
             }
         }
@@ -149,6 +158,30 @@ class PkbManager {
 
     bool has_call_statement(const std::string& s) const;
 
+    // Symbol table-related Read Operations
+    bool is_finalised() const;
+
+    SymbolId get_statement_id(const std::string& statement_number) const;
+
+    std::string get_statement_by_id(SymbolId id) const;
+
+    SymbolId get_variable_id(const std::string& variable) const;
+
+    std::string get_variable_by_id(SymbolId id) const;
+
+    SymbolId get_procedure_id(const std::string& procedure) const;
+
+    std::string get_procedure_by_id(SymbolId id) const;
+
+    SymbolId get_constant_id(const std::string& constant) const;
+
+    std::string get_constant_by_id(SymbolId id) const;
+
+    bool has_statement_type(SymbolId id, StatementType statement_type) const;
+
+    // The varName of a read or print statement or the procName of a call statement, and empty for other statements
+    std::string get_statement_name_attribute(const std::string& s) const;
+
     // Modifies-related Read Operations
     std::unordered_set<std::string> get_vars_modified_by_statement(const std::string& s) const;
 
@@ -286,6 +319,10 @@ class PkbManager {
     std::unordered_set<std::string> get_follows_stars_by(const std::string& stmt,
                                                          const StatementType& statement_type) const;
 
+    SetView<std::string> view_follows_stars_following(const std::string& stmt) const;
+
+    SetView<std::string> view_follows_stars_by(const std::string& stmt) const;
+
     // Parent-related Read Operations
     bool has_parent_relation() const;
 
@@ -342,6 +379,10 @@ class PkbManager {
     std::unordered_set<std::string> get_parent_star_of(const std::string& child,
                                                        const StatementType& statement_type) const;
 
+    SetView<std::string> view_children_star_of(const std::string& parent) const;
+
+    SetView<std::string> view_parent_star_of(const std::string& child) const;
+
     // Next-related Read Operations
     bool has_next_relation() const;
 
@@ -363,6 +404,31 @@ class PkbManager {
 
     std::unordered_map<std::string, std::unordered_set<std::string>> get_all_next_reverse() const;
 
+    SetView<std::string> view_next_of(const std::string& before) const;
+
+    SetView<std::string> view_previous_of(const std::string& after) const;
+
+    // Next*-related Read Operations, only available once the PKB is finalised with the Next* index enabled
+    bool has_next_star_index() const;
+
+    bool has_next_star_relation(const std::string& before, const std::string& after) const;
+
+    std::unordered_set<std::string> get_next_star_of(const std::string& before) const;
+
+    std::unordered_set<std::string> get_previous_star_of(const std::string& after) const;
+
+    // Affects-related Read Operations, memoised until the next write to the PKB
+    bool has_affects_relation(const std::string& stmt1, const std::string& stmt2) const;
+
+    SetView<std::string> view_affected_by(const std::string& stmt) const;
+
+    SetView<std::string> view_affecting(const std::string& stmt) const;
+
+    /**
+     * Computes every Affects pair in one dataflow pass per procedure, keyed by the affecting statement.
+     */
+    const std::unordered_map<std::string, std::unordered_set<std::string>>& get_all_affects() const;
+
     // Calls-related Read Operations
     bool has_calls_relation() const;
 
@@ -441,6 +507,26 @@ class PkbManager {
 
     bool are_stmt_nos_in_same_proc(const std::string& stmt_no_1, const std::string& stmt_no_2) const;
 
+    // Instrumentation of the assignment pattern match cache
+    PatternMatchCache::Statistics get_pattern_match_cache_statistics() const;
+
+    void set_pattern_match_cache_hook(PatternMatchCache::Hook hook);
+
+    // Cardinalities for query planning, read without materialising the stores
+    const StatisticsCatalog& get_statistics() const;
+
+    std::size_t get_relationship_size(RelationshipType relationship_type) const;
+
+    std::size_t get_statement_count() const;
+
+    std::size_t get_statement_count(StatementType statement_type) const;
+
+    std::size_t get_procedure_count() const;
+
+    std::size_t get_variable_count() const;
+
+    std::size_t get_constant_count() const;
+
     // Write APIs
     void add_procedure(std::string procedure);
 
@@ -476,6 +562,30 @@ class PkbManager {
 
     void add_proc_to_stmt_no_mapping(const std::string& procedure, const std::string& stmt_no);
 
+    // Bulk write APIs, each loading many pairs of a relation at once; the stores only index them when finalised
+    using Pairs = std::vector<std::pair<std::string, std::string>>;
+
+    void add_all_statement_modify_vars(Pairs statement_variable_pairs);
+
+    void add_all_procedure_modify_vars(Pairs procedure_variable_pairs);
+
+    void add_all_statement_use_vars(Pairs statement_variable_pairs);
+
+    void add_all_procedure_use_vars(Pairs procedure_variable_pairs);
+
+    void add_all_nexts(Pairs stmt_pairs);
+
+    void add_all_calls(Pairs caller_callee_pairs);
+
+    void add_all_if_vars(Pairs statement_variable_pairs);
+
+    void add_all_while_vars(Pairs statement_variable_pairs);
+
+    /**
+     * Precompute the Next* closure when the PKB is finalised, trading load time and memory for O(1) Next* lookups.
+     */
+    void enable_next_star_index();
+
     void finalise_pkb(const std::vector<std::string>& procedure_order);
 
   private:
@@ -498,6 +608,51 @@ class PkbManager {
     std::shared_ptr<StmtNoToProcCalledStore> stmt_no_to_proc_called_store;
     std::shared_ptr<ProcToStmtNosStore> proc_to_stmt_nos_store;
 
+    // Dense ids assigned at finalise_pkb, see build_symbol_tables
+    bool finalised = false;
+    std::shared_ptr<SymbolTable<StatementNumber>> statement_symbols;
+    std::shared_ptr<SymbolTable<Variable>> variable_symbols;
+    std::shared_ptr<SymbolTable<Procedure>> procedure_symbols;
+    std::shared_ptr<SymbolTable<Constant>> constant_symbols;
+    std::vector<StatementType> statement_types; // Indexed by statement id
+    std::vector<std::string> statement_name_attributes; // Indexed by statement id
+
+    bool next_star_index_enabled = false;
+    std::shared_ptr<NextStarIndex> next_star_index;
+
+    std::shared_ptr<AffectsCache> affects_cache;
+    std::shared_ptr<PatternMatchCache> pattern_match_cache;
+
+    // Computed at finalise_pkb, see build_statistics
+    std::shared_ptr<StatisticsCatalog> statistics;
+
+    std::unordered_set<std::string> to_statements(const std::vector<SymbolId>& ids) const;
+
+    StatementType get_statement_type(const std::string& s) const;
+
+    std::string compute_statement_name_attribute(const std::string& s, StatementType statement_type) const;
+
+    bool kills_var(const std::string& s, const std::string& variable) const;
+
+    std::unordered_set<std::string> compute_affected_by(const std::string& stmt) const;
+
+    std::unordered_set<std::string> compute_affecting(const std::string& stmt) const;
+
+    std::unordered_map<std::string, std::unordered_set<std::string>> compute_all_affects() const;
+
+    void compute_procedure_affects(const std::vector<std::string>& stmts,
+                                   std::unordered_map<std::string, std::unordered_set<std::string>>& affects) const;
+
+    bool has_statement_type(const std::string& s, StatementType statement_type) const;
+
+    void build_symbol_tables();
+
+    void freeze_stores();
+
+    void build_statistics();
+
+    void thaw_stores();
+
     template <class DirectStore, class StarStore, class OrderingStrategy>
     void populate_star_from_direct(std::shared_ptr<DirectStore> direct_store, std::shared_ptr<StarStore> star_store,
                                    OrderingStrategy ordering_strategy);
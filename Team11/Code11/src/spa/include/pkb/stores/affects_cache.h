@@ -0,0 +1,64 @@
+#pragma once
+
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+/**
+ * Class to memoise Affects results in a SIMPLE program. Affects is never stored eagerly; the set of statements
+ * affected by (or affecting) a statement is computed on first demand and kept until the cache is cleared.
+ *
+ * Lookups may run concurrently. Memoised sets are never replaced once published, so returned references stay valid
+ * across concurrent lookups until the cache is cleared.
+ */
+class AffectsCache {
+  public:
+    using StatementSet = std::unordered_set<std::string>;
+    using AffectsMap = std::unordered_map<std::string, StatementSet>;
+    using Compute = std::function<StatementSet(const std::string&)>;
+    using ComputeAll = std::function<AffectsMap()>;
+
+    AffectsCache();
+
+    /**
+     * Retrieves the statements affected by a statement, computing them on a miss.
+     *
+     * @param statement The statement that affects the results.
+     * @param compute The computation to run on a miss.
+     * @return The memoised set, valid until the cache is cleared.
+     */
+    const StatementSet& get_affected_by(const std::string& statement, const Compute& compute);
+
+    /**
+     * Retrieves the statements affecting a statement, computing them on a miss.
+     *
+     * @param statement The statement affected by the results.
+     * @param compute The computation to run on a miss.
+     * @return The memoised set, valid until the cache is cleared.
+     */
+    const StatementSet& get_affecting(const std::string& statement, const Compute& compute);
+
+    /**
+     * Retrieves every Affects pair, computing the whole relation in bulk on the first call. Afterwards every lookup is
+     * served from the cache without further computation.
+     *
+     * @param compute_all The computation of all Affects pairs, keyed by the affecting statement.
+     * @return The memoised pairs, valid until the cache is cleared.
+     */
+    const AffectsMap& get_all_affects(const ComputeAll& compute_all);
+
+    /**
+     * Discards every memoised result, e.g. when the program is reloaded.
+     */
+    void clear();
+
+  private:
+    mutable std::mutex mutex;
+    AffectsMap affected_by;
+    AffectsMap affecting;
+    bool is_complete = false; // Whether both maps hold the whole relation
+
+    const StatementSet& get_or_compute(AffectsMap& memo, const std::string& statement, const Compute& compute);
+};
@@ -64,6 +64,12 @@ class EntityStore {
      */
     [[nodiscard]] ConstantSet get_constants() const;
 
+    [[nodiscard]] std::size_t get_procedure_count() const;
+
+    [[nodiscard]] std::size_t get_variable_count() const;
+
+    [[nodiscard]] std::size_t get_constant_count() const;
+
   private:
     ProcedureSet procedureSet;
     VariableSet variableSet;
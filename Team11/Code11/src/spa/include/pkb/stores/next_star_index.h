@@ -0,0 +1,44 @@
+#pragma once
+
+#include "pkb/common_types/symbol_id.h"
+#include "pkb/stores/next_store.h"
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * Precomputed Next* closure over statement ids, built from a frozen NextStore.
+ *
+ * The Next graph is condensed into its strongly connected components, and every component keeps a bitset of the
+ * components it reaches (and is reached from). Next never crosses procedures, so the bitsets only span the
+ * components of the same connected CFG, which keeps them small. A statement reaches itself only through a cycle.
+ */
+class NextStarIndex {
+  public:
+    NextStarIndex(std::size_t num_statements, const NextStore& next_store);
+
+    [[nodiscard]] bool contains(SymbolId before, SymbolId after) const;
+
+    [[nodiscard]] std::vector<SymbolId> get_reachable_from(SymbolId before) const;
+
+    [[nodiscard]] std::vector<SymbolId> get_reaching(SymbolId after) const;
+
+  private:
+    using Word = std::uint64_t;
+    static constexpr std::size_t BITS_PER_WORD = 64;
+
+    // Strongly connected components, numbered consecutively within each connected CFG
+    std::vector<SymbolId> scc_of_statement;
+    std::vector<std::size_t> scc_offsets;
+    std::vector<SymbolId> scc_statements;
+
+    // For every component, the first component of its CFG and the offset of its bitsets
+    std::vector<SymbolId> first_scc_of_cfg;
+    std::vector<std::size_t> bitset_offsets;
+    std::vector<Word> reachable_from;
+    std::vector<Word> reaching;
+
+    [[nodiscard]] std::size_t num_sccs() const;
+
+    [[nodiscard]] std::vector<SymbolId> collect(const std::vector<Word>& bitsets, SymbolId scc) const;
+};
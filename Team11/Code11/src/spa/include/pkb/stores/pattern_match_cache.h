@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+/**
+ * Bounded LRU cache of assignment pattern matches. Query batches tend to repeat the same expression spec many times,
+ * so the statements matching a (lhs, expression, exact or partial) spec are kept until the cache is cleared or they
+ * are the least recently used entry of a full cache. Lookups may run concurrently.
+ */
+class PatternMatchCache {
+  public:
+    using StatementSet = std::unordered_set<std::string>;
+    using Compute = std::function<StatementSet()>;
+
+    struct Statistics {
+        std::size_t hits = 0;
+        std::size_t misses = 0;
+        std::size_t evictions = 0;
+
+        [[nodiscard]] double hit_rate() const;
+    };
+
+    // Called after every lookup with the statistics so far; calls are serialised by the cache
+    using Hook = std::function<void(const Statistics&)>;
+
+    static constexpr std::size_t DEFAULT_CAPACITY = 1024;
+
+    explicit PatternMatchCache(std::size_t capacity = DEFAULT_CAPACITY);
+
+    /**
+     * Retrieves the statements matching a pattern, computing them on a miss.
+     *
+     * @param lhs The variable on the left-hand side, or empty for a wildcard.
+     * @param postfix The expression in postfix form; whitespace between tokens is normalised.
+     * @param is_partial Whether the expression may match any subtree instead of the whole right-hand side.
+     * @param compute The computation to run on a miss.
+     */
+    StatementSet get_matches(const std::string& lhs, const std::string& postfix, bool is_partial,
+                             const Compute& compute);
+
+    [[nodiscard]] Statistics get_statistics() const;
+
+    void set_hook(Hook new_hook);
+
+    /**
+     * Discards every cached match, e.g. when the program is reloaded. The statistics are kept.
+     */
+    void clear();
+
+  private:
+    using Entry = std::pair<std::string, StatementSet>;
+
+    std::size_t capacity;
+    mutable std::mutex mutex;
+    // Most recently used entries first
+    std::list<Entry> entries;
+    std::unordered_map<std::string, std::list<Entry>::iterator> entry_of_key;
+    Statistics statistics;
+    Hook hook;
+
+    static std::string make_key(const std::string& lhs, const std::string& postfix, bool is_partial);
+};
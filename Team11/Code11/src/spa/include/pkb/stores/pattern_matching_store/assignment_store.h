@@ -3,14 +3,17 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "pkb/common_types/statement_number.h"
 #include "pkb/common_types/variable.h"
+#include "pkb/stores/pattern_matching_store/expression_dag.h"
 
 class AssignmentStore {
   public:
+    // Assignments keyed by the DAG node of their rhs
     using AssignmentStoreType =
-        std::unordered_map<std::string, std::unordered_map<Variable, std::unordered_set<std::string>>>;
+        std::unordered_map<ExpressionDag::NodeId, std::unordered_map<Variable, std::unordered_set<std::string>>>;
 
     AssignmentStore();
 
@@ -32,5 +35,12 @@ class AssignmentStore {
     std::unordered_set<std::string> get_all_assignments_lhs_rhs_partial(const Variable& lhs, const std::string& rhs);
 
   private:
+    ExpressionDag expressions;
     AssignmentStoreType assignment_store;
+    // Assignments whose rhs is not a well-formed postfix expression; they only match on their lhs
+    std::unordered_map<Variable, std::unordered_set<std::string>> unparsed_assignments;
+    // Every DAG node mapped to the rhs roots that contain it as a subtree
+    std::unordered_map<ExpressionDag::NodeId, std::vector<ExpressionDag::NodeId>> roots_containing;
+
+    const std::vector<ExpressionDag::NodeId>& get_roots_containing(const std::string& rhs) const;
 };
\ No newline at end of file
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Hash-consed DAG of the expressions on the right-hand side of assignments. Every distinct subexpression of the
+ * program is stored once and identified by a node id, so two expressions are structurally equal exactly when their
+ * ids are equal. Expressions are given in the postfix form produced by the SP, e.g. "x y + 2 * ".
+ */
+class ExpressionDag {
+  public:
+    using NodeId = std::uint32_t;
+
+    /**
+     * Adds a postfix expression, reusing the nodes of subexpressions that are already in the DAG.
+     *
+     * @return The node ids of every subtree of the expression in postfix order, ending with the root. A malformed
+     * expression yields no ids.
+     */
+    std::vector<NodeId> add(std::string_view postfix);
+
+    /**
+     * Finds the node of a postfix expression without adding it.
+     *
+     * @return The id of the root, or nothing if the expression does not occur anywhere in the DAG.
+     */
+    std::optional<NodeId> find(std::string_view postfix) const;
+
+    std::size_t size() const;
+
+  private:
+    // Operator nodes are identified by their operator and the ids of their two operands
+    using OperatorKey = std::tuple<char, NodeId, NodeId>;
+
+    struct OperatorKeyHash {
+        std::size_t operator()(const OperatorKey& key) const;
+    };
+
+    std::unordered_map<std::string, NodeId> leaf_ids;
+    std::unordered_map<OperatorKey, NodeId, OperatorKeyHash> operator_ids;
+    NodeId num_nodes = 0;
+};
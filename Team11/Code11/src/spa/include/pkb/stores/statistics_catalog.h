@@ -0,0 +1,68 @@
+#pragma once
+
+#include "common/statement_type.hpp"
+#include "pkb/common_types/relationship_type.h"
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+inline constexpr std::size_t NUM_STATEMENT_TYPES = static_cast<std::size_t>(StatementType::Print) + 1;
+inline constexpr std::size_t NUM_RELATIONSHIP_TYPES = static_cast<std::size_t>(RelationshipType::CallsStar) + 1;
+
+using StatementTypeHistogram = std::array<std::size_t, NUM_STATEMENT_TYPES>;
+
+/**
+ * Cardinalities of one stored relation. The histograms count pairs by the statement type of their key (or value), and
+ * stay empty for sides that are not statements.
+ */
+struct RelationStatistics {
+    std::size_t size = 0;
+    std::size_t distinct_keys = 0;
+    std::size_t distinct_values = 0;
+    StatementTypeHistogram key_histogram{};
+    StatementTypeHistogram value_histogram{};
+
+    // Average number of values per key that has any
+    [[nodiscard]] double get_average_fan_out() const;
+
+    // Average number of keys per value that has any
+    [[nodiscard]] double get_average_fan_in() const;
+};
+
+/**
+ * Class to hold the cardinalities of a SIMPLE program, computed once when the PKB is finalised so that they can be read
+ * without materialising any store, e.g. to plan the evaluation of a query.
+ */
+class StatisticsCatalog {
+  public:
+    StatisticsCatalog();
+
+    void set_statement_types(const std::vector<StatementType>& statement_types);
+
+    void set_entity_counts(std::size_t num_procedures, std::size_t num_variables, std::size_t num_constants);
+
+    void set_relation_statistics(RelationshipType relationship_type, const RelationStatistics& relation_statistics);
+
+    [[nodiscard]] std::size_t get_statement_count() const;
+
+    [[nodiscard]] std::size_t get_statement_count(StatementType statement_type) const;
+
+    [[nodiscard]] const StatementTypeHistogram& get_statement_histogram() const;
+
+    [[nodiscard]] std::size_t get_procedure_count() const;
+
+    [[nodiscard]] std::size_t get_variable_count() const;
+
+    [[nodiscard]] std::size_t get_constant_count() const;
+
+    [[nodiscard]] const RelationStatistics& get_relation_statistics(RelationshipType relationship_type) const;
+
+  private:
+    std::size_t num_statements = 0;
+    StatementTypeHistogram statement_histogram{};
+    std::size_t num_procedures = 0;
+    std::size_t num_variables = 0;
+    std::size_t num_constants = 0;
+    std::array<RelationStatistics, NUM_RELATIONSHIP_TYPES> relations{};
+};
@@ -1,16 +1,38 @@
 #pragma once
 
+#include "pkb/common_types/relationship_type.h"
 #include "qps/evaluators/data_source.hpp"
+#include "qps/evaluators/query_trace.hpp"
 #include "qps/evaluators/results_table.hpp"
 
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include <utility>
+
 namespace qps {
+/**
+ * What the rest of a query needs from a clause. The columns of unneeded synonyms are left out, so only the distinct
+ * values of the other synonyms are kept; a clause whose synonyms are all unneeded is only checked for a witness.
+ */
+struct ClauseDemand {
+    Synonyms unneeded;
+    bool is_existence_only = false;
+};
+
 class ClauseEvaluator {
     DataSource data_source;
-    bool is_negated;
+    ClauseDemand demand;
+    // The access path of the last evaluation, if the evaluator had to choose one
+    mutable std::optional<AccessPathChoice> access_path_choice;
 
     [[nodiscard]] virtual auto evaluate_positive() const -> OutputTable = 0;
 
-    [[nodiscard]] virtual auto negate_result(OutputTable output) const -> OutputTable;
+    // Whether the clause holds for any row; evaluators that can stop at the first witness override this
+    [[nodiscard]] virtual auto has_witness() const -> bool {
+        return !is_empty(evaluate_positive());
+    }
 
   protected:
     std::shared_ptr<pkb::ReadFacade> read_facade;
@@ -19,13 +41,59 @@ class ClauseEvaluator {
         return data_source.get_data(synonym);
     }
 
+    // Evaluators may skip the column of an unneeded synonym, emitting each value of the other synonyms once
+    [[nodiscard]] auto is_needed(const std::shared_ptr<Synonym>& synonym) const -> bool {
+        return std::find(demand.unneeded.begin(), demand.unneeded.end(), synonym) == demand.unneeded.end();
+    }
+
+    // Probes the relation when its smaller bound domain has fewer candidates than the relation has pairs
+    [[nodiscard]] auto choose_access_path(const std::unordered_set<std::string>& keys,
+                                          const std::unordered_set<std::string>& values,
+                                          RelationshipType relationship_type) const -> AccessPath;
+
+    /**
+     * Adds the related (key, value) pairs to a table by looking up the other side of each candidate on the smaller
+     * side. get_values_of and get_keys_of return the values related to a key and the keys related to a value.
+     */
+    template <typename GetValuesOf, typename GetKeysOf>
+    auto probe(Table& table, const std::unordered_set<std::string>& keys,
+               const std::unordered_set<std::string>& values, const GetValuesOf& get_values_of,
+               const GetKeysOf& get_keys_of) const -> void {
+        if (keys.size() <= values.size()) {
+            for (const auto& key : keys) {
+                for (const auto& value : get_values_of(key)) {
+                    if (values.find(value) != values.end()) {
+                        table.add_row({key, value});
+                    }
+                }
+            }
+        } else {
+            for (const auto& value : values) {
+                for (const auto& key : get_keys_of(value)) {
+                    if (keys.find(key) != keys.end()) {
+                        table.add_row({key, value});
+                    }
+                }
+            }
+        }
+    }
+
   public:
-    explicit ClauseEvaluator(DataSource data_source, std::shared_ptr<pkb::ReadFacade> read_facade, bool is_negated)
-        : data_source(std::move(data_source)), is_negated(is_negated), read_facade(std::move(read_facade)) {
+    explicit ClauseEvaluator(DataSource data_source, std::shared_ptr<pkb::ReadFacade> read_facade)
+        : data_source(std::move(data_source)), read_facade(std::move(read_facade)) {
     }
 
     virtual ~ClauseEvaluator() = default;
 
+    // Negated clauses are always evaluated in full, as the query evaluator anti-joins their result
+    auto set_demand(ClauseDemand new_demand) -> void {
+        demand = std::move(new_demand);
+    }
+
     [[nodiscard]] auto evaluate() const -> OutputTable;
+
+    [[nodiscard]] auto get_access_path_choice() const -> std::optional<AccessPathChoice> {
+        return access_path_choice;
+    }
 };
 } // namespace qps
\ No newline at end of file
@@ -48,9 +48,8 @@ class PatternAssignEvaluator : public ClauseEvaluator {
         -> OutputTable;
 
   public:
-    PatternAssignEvaluator(DataSource data_source, std::shared_ptr<pkb::ReadFacade> read_facade, PatternAssign pattern,
-                           bool is_negated)
-        : ClauseEvaluator(std::move(data_source), std::move(read_facade), is_negated), pattern(std::move(pattern)) {
+    PatternAssignEvaluator(DataSource data_source, std::shared_ptr<pkb::ReadFacade> read_facade, PatternAssign pattern)
+        : ClauseEvaluator(std::move(data_source), std::move(read_facade)), pattern(std::move(pattern)) {
     }
 
     [[nodiscard]] auto evaluate_positive() const -> OutputTable override;
@@ -23,9 +23,8 @@ class PatternWhileEvaluator : public ClauseEvaluator {
     [[nodiscard]] auto eval_pattern_while(const qps::WildCard&) const -> OutputTable;
 
   public:
-    PatternWhileEvaluator(DataSource data_source, std::shared_ptr<pkb::ReadFacade> read_facade, PatternWhile pattern,
-                          bool is_negated)
-        : ClauseEvaluator(std::move(data_source), std::move(read_facade), is_negated), pattern(std::move(pattern)) {
+    PatternWhileEvaluator(DataSource data_source, std::shared_ptr<pkb::ReadFacade> read_facade, PatternWhile pattern)
+        : ClauseEvaluator(std::move(data_source), std::move(read_facade)), pattern(std::move(pattern)) {
     }
 
     [[nodiscard]] auto evaluate_positive() const -> OutputTable override;
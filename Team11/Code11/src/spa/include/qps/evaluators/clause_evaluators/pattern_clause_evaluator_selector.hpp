@@ -10,18 +10,18 @@
 
 namespace qps {
 auto pattern_clause_evaluator_selector(const DataSource& data_source,
-                                       const std::shared_ptr<pkb::ReadFacade>& read_facade, bool is_negated) {
+                                       const std::shared_ptr<pkb::ReadFacade>& read_facade) {
     return overloaded{
-        [&data_source, read_facade, is_negated](const qps::PatternAssign& pattern) -> std::shared_ptr<ClauseEvaluator> {
-            return std::make_shared<PatternAssignEvaluator>(data_source, read_facade, pattern, is_negated);
+        [&data_source, read_facade](const qps::PatternAssign& pattern) -> std::shared_ptr<ClauseEvaluator> {
+            return std::make_shared<PatternAssignEvaluator>(data_source, read_facade, pattern);
         },
 
-        [&data_source, read_facade, is_negated](const qps::PatternIf& pattern) -> std::shared_ptr<ClauseEvaluator> {
-            return std::make_shared<PatternIfEvaluator>(data_source, read_facade, pattern, is_negated);
+        [&data_source, read_facade](const qps::PatternIf& pattern) -> std::shared_ptr<ClauseEvaluator> {
+            return std::make_shared<PatternIfEvaluator>(data_source, read_facade, pattern);
         },
 
-        [&data_source, read_facade, is_negated](const qps::PatternWhile& pattern) -> std::shared_ptr<ClauseEvaluator> {
-            return std::make_shared<PatternWhileEvaluator>(data_source, read_facade, pattern, is_negated);
+        [&data_source, read_facade](const qps::PatternWhile& pattern) -> std::shared_ptr<ClauseEvaluator> {
+            return std::make_shared<PatternWhileEvaluator>(data_source, read_facade, pattern);
         }};
 }
 } // namespace qps
@@ -47,10 +47,12 @@ class AffectsEvaluator : public ClauseEvaluator {
     // e.g. Next*(_, _)
     [[nodiscard]] auto eval_affects(const qps::WildCard&, const qps::WildCard&) const -> OutputTable;
 
+    // Stops at the first pair of statements that affect each other
+    [[nodiscard]] auto has_witness() const -> bool override;
+
   public:
-    AffectsEvaluator(DataSource data_source, std::shared_ptr<pkb::ReadFacade> read_facade, Affects affects,
-                     bool is_negated)
-        : ClauseEvaluator(std::move(data_source), std::move(read_facade), is_negated), affects(std::move(affects)) {
+    AffectsEvaluator(DataSource data_source, std::shared_ptr<pkb::ReadFacade> read_facade, Affects affects)
+        : ClauseEvaluator(std::move(data_source), std::move(read_facade)), affects(std::move(affects)) {
     }
 
     [[nodiscard]] auto evaluate_positive() const -> OutputTable override;
@@ -43,8 +43,8 @@ class CallsEvaluator : public ClauseEvaluator {
     [[nodiscard]] auto eval_calls(const qps::WildCard&, const qps::WildCard&) const -> OutputTable;
 
   public:
-    CallsEvaluator(DataSource data_source, std::shared_ptr<pkb::ReadFacade> read_facade, Calls calls, bool is_negated)
-        : ClauseEvaluator(std::move(data_source), std::move(read_facade), is_negated), calls(std::move(calls)) {
+    CallsEvaluator(DataSource data_source, std::shared_ptr<pkb::ReadFacade> read_facade, Calls calls)
+        : ClauseEvaluator(std::move(data_source), std::move(read_facade)), calls(std::move(calls)) {
     }
 
     [[nodiscard]] auto evaluate_positive() const -> OutputTable override;
@@ -42,9 +42,8 @@ class CallsTEvaluator : public ClauseEvaluator {
     [[nodiscard]] auto eval_calls_t(const qps::WildCard&, const qps::WildCard&) const -> OutputTable;
 
   public:
-    CallsTEvaluator(DataSource data_source, std::shared_ptr<pkb::ReadFacade> read_facade, CallsT calls_t,
-                    bool is_negated)
-        : ClauseEvaluator(std::move(data_source), std::move(read_facade), is_negated), calls_t(std::move(calls_t)) {
+    CallsTEvaluator(DataSource data_source, std::shared_ptr<pkb::ReadFacade> read_facade, CallsT calls_t)
+        : ClauseEvaluator(std::move(data_source), std::move(read_facade)), calls_t(std::move(calls_t)) {
     }
 
     [[nodiscard]] auto evaluate_positive() const -> OutputTable override;
@@ -51,9 +51,8 @@ class FollowsEvaluator : public ClauseEvaluator {
     [[nodiscard]] auto eval_follows(const qps::WildCard&, const qps::WildCard&) const -> OutputTable;
 
   public:
-    FollowsEvaluator(DataSource data_source, std::shared_ptr<pkb::ReadFacade> read_facade, Follows follows,
-                     bool is_negated)
-        : ClauseEvaluator(std::move(data_source), std::move(read_facade), is_negated), follows(std::move(follows)) {
+    FollowsEvaluator(DataSource data_source, std::shared_ptr<pkb::ReadFacade> read_facade, Follows follows)
+        : ClauseEvaluator(std::move(data_source), std::move(read_facade)), follows(std::move(follows)) {
     }
 
     [[nodiscard]] auto evaluate_positive() const -> OutputTable override;
@@ -7,6 +7,7 @@
 #include "qps/evaluators/clause_evaluators/clause_evaluator.hpp"
 #include "qps/evaluators/data_source.hpp"
 #include "qps/parser/entities/relationship.hpp"
+#include "qps/utils/algo.h"
 
 namespace qps {
 class NextTEvaluator : public ClauseEvaluator {
@@ -14,10 +15,23 @@ class NextTEvaluator : public ClauseEvaluator {
 
     [[nodiscard]] auto select_eval_method() const;
 
+    // Views the Next graph in place instead of copying it
+    [[nodiscard]] auto next_of() const -> Neighbours;
+
+    [[nodiscard]] auto previous_of() const -> Neighbours;
+
     // e.g. Next*(s1, s2)
     [[nodiscard]] auto eval_next_t(const std::shared_ptr<StmtSynonym>& stmt_syn_1,
                                    const std::shared_ptr<StmtSynonym>& stmt_syn_2) const -> OutputTable;
 
+    // Next*(s1, s2) served from the precomputed Next* index
+    [[nodiscard]] auto eval_next_t_indexed(const std::shared_ptr<StmtSynonym>& stmt_syn_1,
+                                           const std::shared_ptr<StmtSynonym>& stmt_syn_2) const -> OutputTable;
+
+    // Whether any of the targets can execute after the statement, using the Next* index
+    [[nodiscard]] auto reaches_any(const std::string& stmt, const std::unordered_set<std::string>& targets) const
+        -> bool;
+
     // e.g. Next*(s1, 3)
     [[nodiscard]] auto eval_next_t(const std::shared_ptr<StmtSynonym>& stmt_syn_1, const qps::Integer& stmt_num_2) const
         -> OutputTable;
@@ -46,9 +60,12 @@ class NextTEvaluator : public ClauseEvaluator {
     // e.g. Next*(_, _)
     [[nodiscard]] auto eval_next_t(const qps::WildCard&, const qps::WildCard&) const -> OutputTable;
 
+    // Stops at the first pair of statements where one can execute after the other
+    [[nodiscard]] auto has_witness() const -> bool override;
+
   public:
-    NextTEvaluator(DataSource data_source, std::shared_ptr<pkb::ReadFacade> read_facade, NextT next_t, bool is_negated)
-        : ClauseEvaluator(std::move(data_source), std::move(read_facade), is_negated), next_t(std::move(next_t)) {
+    NextTEvaluator(DataSource data_source, std::shared_ptr<pkb::ReadFacade> read_facade, NextT next_t)
+        : ClauseEvaluator(std::move(data_source), std::move(read_facade)), next_t(std::move(next_t)) {
     }
 
     [[nodiscard]] auto evaluate_positive() const -> OutputTable override;
@@ -46,9 +46,8 @@ class ParentEvaluator : public ClauseEvaluator {
     [[nodiscard]] auto eval_parent(const qps::WildCard&, const qps::WildCard&) const -> OutputTable;
 
   public:
-    ParentEvaluator(DataSource data_source, std::shared_ptr<pkb::ReadFacade> read_facade, Parent parent,
-                    bool is_negated)
-        : ClauseEvaluator(std::move(data_source), std::move(read_facade), is_negated), parent(std::move(parent)) {
+    ParentEvaluator(DataSource data_source, std::shared_ptr<pkb::ReadFacade> read_facade, Parent parent)
+        : ClauseEvaluator(std::move(data_source), std::move(read_facade)), parent(std::move(parent)) {
     }
 
     [[nodiscard]] auto evaluate_positive() const -> OutputTable override;
@@ -47,9 +47,8 @@ class ParentTEvaluator : public ClauseEvaluator {
     [[nodiscard]] auto eval_parent_t(const qps::WildCard&, const qps::WildCard&) const -> OutputTable;
 
   public:
-    ParentTEvaluator(DataSource data_source, std::shared_ptr<pkb::ReadFacade> read_facade, ParentT parent_t,
-                     bool is_negated)
-        : ClauseEvaluator(std::move(data_source), std::move(read_facade), is_negated), parent_t(std::move(parent_t)) {
+    ParentTEvaluator(DataSource data_source, std::shared_ptr<pkb::ReadFacade> read_facade, ParentT parent_t)
+        : ClauseEvaluator(std::move(data_source), std::move(read_facade)), parent_t(std::move(parent_t)) {
     }
 
     [[nodiscard]] auto evaluate_positive() const -> OutputTable override;
@@ -37,8 +37,8 @@ class UsesSEvaluator : public ClauseEvaluator {
     [[nodiscard]] auto eval_uses_s(const qps::Integer& stmt_num, const qps::WildCard&) const -> OutputTable;
 
   public:
-    UsesSEvaluator(DataSource data_source, std::shared_ptr<pkb::ReadFacade> read_facade, UsesS uses_s, bool is_negated)
-        : ClauseEvaluator(std::move(data_source), std::move(read_facade), is_negated), uses_s(std::move(uses_s)) {
+    UsesSEvaluator(DataSource data_source, std::shared_ptr<pkb::ReadFacade> read_facade, UsesS uses_s)
+        : ClauseEvaluator(std::move(data_source), std::move(read_facade)), uses_s(std::move(uses_s)) {
     }
 
     [[nodiscard]] auto evaluate_positive() const -> OutputTable override;
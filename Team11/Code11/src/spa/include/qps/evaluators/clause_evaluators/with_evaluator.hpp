@@ -44,9 +44,8 @@ class WithEvaluator : public ClauseEvaluator {
     [[nodiscard]] auto eval_with(const qps::Integer& integer_1, const qps::Integer& integer_2) const -> OutputTable;
 
   public:
-    WithEvaluator(DataSource data_source, std::shared_ptr<pkb::ReadFacade> read_facade, TypedRef ref_1, TypedRef ref_2,
-                  bool is_negated)
-        : ClauseEvaluator(std::move(data_source), std::move(read_facade), is_negated), ref_1(std::move(ref_1)),
+    WithEvaluator(DataSource data_source, std::shared_ptr<pkb::ReadFacade> read_facade, TypedRef ref_1, TypedRef ref_2)
+        : ClauseEvaluator(std::move(data_source), std::move(read_facade)), ref_1(std::move(ref_1)),
           ref_2(std::move(ref_2)) {
     }
 
@@ -1,28 +1,59 @@
 #pragma once
 
+#include "common/utils/thread_pool.hpp"
 #include "pkb/facades/read_facade.h"
 #include "qps/evaluators/clause_evaluators/clause_evaluator.hpp"
+#include "qps/evaluators/query_trace.hpp"
 #include "qps/evaluators/results_table.hpp"
 #include "qps/optimisers/default.hpp"
 #include "qps/parser/analysers/semantic_analyser.hpp"
 
+#include <atomic>
+#include <cstddef>
 #include <memory>
 #include <utility>
 #include <vector>
 
 namespace qps {
+namespace detail {
+/**
+ * The columns each clause of a query produces and keeps. A synonym the reference does not select is dead after the
+ * last clause that refers to it, so its column is dropped there; a clause that is the only one referring to it leaves
+ * the column out altogether, and a clause with only such synonyms just needs a witness.
+ */
+struct ColumnPlan {
+    std::vector<ClauseDemand> demands;
+    std::vector<Synonyms> dead_after;
+};
+
+auto plan_columns(const Query& query_obj) -> ColumnPlan;
+} // namespace detail
+
 class QueryEvaluator {
-    std::shared_ptr<ClauseEvaluator> evaluator;
-    const std::shared_ptr<Optimiser> optimiser = std::make_shared<DefaultOptimiser>();
+    const std::shared_ptr<Optimiser> optimiser;
     std::shared_ptr<pkb::ReadFacade> read_facade;
+    // Evaluates the independent groups of a query concurrently, or null to evaluate them one after another
+    std::shared_ptr<ThreadPool> thread_pool;
+    // Receives the access path chosen for each clause, or null if queries are not traced
+    std::shared_ptr<QueryTrace> trace;
 
   private:
     [[nodiscard]] auto optimise(const Query& query) const -> std::vector<Query>;
 
-    auto evaluate_query(const Query& query) -> OutputTable;
+    // Gives up with an empty table once cancelled, i.e. when another group of the same query has no results
+    [[nodiscard]] auto evaluate_query(const Query& query, const std::atomic<bool>& cancelled) const -> OutputTable;
+
+    // Evaluates the groups in order, stopping at the first one with no results, which is then the last table returned
+    [[nodiscard]] auto evaluate_groups(const std::vector<Query>& queries) const -> std::vector<OutputTable>;
 
   public:
-    QueryEvaluator(std::shared_ptr<pkb::ReadFacade> read_facade) : read_facade(std::move(read_facade)) {
+    QueryEvaluator(std::shared_ptr<pkb::ReadFacade> read_facade, std::size_t num_threads = 1)
+        : optimiser(std::make_shared<DefaultOptimiser>(read_facade)), read_facade(std::move(read_facade)),
+          thread_pool(num_threads > 1 ? std::make_shared<ThreadPool>(num_threads) : nullptr) {
+    }
+
+    auto set_trace(std::shared_ptr<QueryTrace> new_trace) -> void {
+        trace = std::move(new_trace);
     }
 
     auto evaluate(const qps::Query& query_obj) -> std::vector<std::string>;
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace qps {
+
+/**
+ * How a relationship evaluator reads the relation: probing the store once per candidate of its smaller bound domain,
+ * or scanning every pair of the relation and filtering them against both domains.
+ */
+enum class AccessPath { Probe, Scan };
+
+auto operator<<(std::ostream& os, AccessPath access_path) -> std::ostream&;
+
+struct AccessPathChoice {
+    AccessPath access_path;
+    std::size_t num_candidates;
+    std::size_t relation_size;
+};
+
+/**
+ * Records how the clauses of queries were evaluated, in the order they were evaluated. Groups of a query may be
+ * evaluated concurrently, so entries can be recorded from several threads.
+ */
+class QueryTrace {
+  public:
+    struct Entry {
+        std::string clause;
+        AccessPathChoice choice;
+    };
+
+    auto record(std::string clause, AccessPathChoice choice) -> void;
+
+    [[nodiscard]] auto get_entries() const -> std::vector<Entry>;
+
+    auto clear() -> void;
+
+  private:
+    mutable std::mutex mutex;
+    std::vector<Entry> entries;
+};
+} // namespace qps
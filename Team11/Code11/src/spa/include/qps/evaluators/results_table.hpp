@@ -1,8 +1,11 @@
 #pragma once
 
 #include "pkb/facades/read_facade.h"
+#include "qps/evaluators/value_dictionary.hpp"
 #include "qps/parser/analysers/semantic_analyser.hpp"
 #include "qps/parser/entities/synonym.hpp"
+#include <algorithm>
+#include <functional>
 #include <memory>
 #include <unordered_map>
 #include <unordered_set>
@@ -13,16 +16,34 @@ namespace qps {
 
 struct UnitTable {};
 
+template <class T>
+void reorder(std::vector<T>& v, std::vector<int> const& order) {
+    std::vector<T> v_copy(order.size());
+    for (size_t s = 0; s < order.size(); ++s) {
+        v_copy[s] = v[order[s]];
+    }
+
+    v = v_copy;
+}
+
+/**
+ * Columnar table of intermediate results. Each synonym owns one contiguous column of ids into the value dictionary
+ * of the table, see ValueDictionary; rows are only materialised as strings when requested.
+ *
+ * The table also remembers the columns its rows are known to be sorted on, so that joins can skip sorting.
+ */
 class Table {
     std::vector<std::shared_ptr<Synonym>> record_type;
-    std::vector<std::vector<std::string>> record_value;
-
-    std::unordered_map<std::string, std::unordered_set<std::string>> synonym_to_values;
+    std::vector<std::vector<ValueId>> columns;
+    std::size_t num_rows = 0;
+    std::vector<std::shared_ptr<Synonym>> sort_key;
+    std::shared_ptr<ValueDictionary> dictionary = ValueDictionary::current();
 
   public:
     Table() = default;
 
-    Table(const std::vector<std::shared_ptr<Synonym>>& column_keys) : record_type(column_keys) {
+    Table(const std::vector<std::shared_ptr<Synonym>>& column_keys)
+        : record_type(column_keys), columns(column_keys.size()) {
 #ifdef DEBUG
         auto name_set = std::unordered_set<std::shared_ptr<Synonym>>(column_keys.begin(), column_keys.end());
         if (name_set.size() != column_keys.size()) {
@@ -31,40 +52,66 @@ class Table {
 #endif
     }
 
-    auto add_row(const std::vector<std::string>& record) -> void {
-        record_value.push_back(record);
-        for (size_t i = 0; i < record.size(); ++i) {
-            synonym_to_values[record_type[i]->get_name_string()].insert(record[i]);
-        }
+    Table(std::vector<std::shared_ptr<Synonym>> column_keys, std::vector<std::vector<ValueId>> columns,
+          std::shared_ptr<ValueDictionary> dictionary)
+        : record_type(std::move(column_keys)), columns(std::move(columns)),
+          num_rows(this->columns.empty() ? 0 : this->columns.front().size()), dictionary(std::move(dictionary)) {
     }
 
+    auto add_row(const std::vector<std::string>& record) -> void;
+
     [[nodiscard]] auto get_column() const -> std::vector<std::shared_ptr<Synonym>> {
         return record_type;
     }
 
-    [[nodiscard]] auto get_records() const -> std::vector<std::vector<std::string>> {
-        return record_value;
+    // Materialises the rows as strings
+    [[nodiscard]] auto get_records() const -> std::vector<std::vector<std::string>>;
+
+    [[nodiscard]] auto get_column_ids(int idx) const -> const std::vector<ValueId>& {
+        return columns[idx];
+    }
+
+    // Callers that modify the ids are responsible for clearing the sort key
+    [[nodiscard]] auto get_column_ids(int idx) -> std::vector<ValueId>& {
+        return columns[idx];
     }
 
-    [[nodiscard]] auto get_column() -> std::vector<std::shared_ptr<Synonym>>& {
-        return record_type;
+    [[nodiscard]] auto get_dictionary() const -> const std::shared_ptr<ValueDictionary>& {
+        return dictionary;
+    }
+
+    // Re-encodes the ids into the given dictionary, so that the table can be joined with the tables using it
+    auto use_dictionary(const std::shared_ptr<ValueDictionary>& new_dictionary) -> void;
+
+    [[nodiscard]] auto get_sort_key() const -> const std::vector<std::shared_ptr<Synonym>>& {
+        return sort_key;
+    }
+
+    auto set_sort_key(std::vector<std::shared_ptr<Synonym>> key) -> void {
+        sort_key = std::move(key);
     }
 
-    [[nodiscard]] auto get_records() -> std::vector<std::vector<std::string>>& {
-        return record_value;
+    // Whether the rows are sorted lexicographically on the given columns, in that order
+    [[nodiscard]] auto is_sorted_on(const std::vector<std::shared_ptr<Synonym>>& key) const -> bool {
+        return num_rows <= 1 ||
+               (key.size() <= sort_key.size() && std::equal(key.begin(), key.end(), sort_key.begin()));
+    }
+
+    auto reorder_columns(const std::vector<int>& order) -> void {
+        reorder(record_type, order);
+        reorder(columns, order);
+    }
+
+    [[nodiscard]] auto size() const -> std::size_t {
+        return num_rows;
     }
 
     [[nodiscard]] auto empty() const -> bool {
-        return record_type.empty() || record_value.empty();
+        return record_type.empty() || num_rows == 0;
     }
 
     [[nodiscard]] auto get_column_value(const std::shared_ptr<Synonym>& synonym) const
-        -> std::unordered_set<std::string> {
-        if (synonym_to_values.find(synonym->get_name_string()) == synonym_to_values.end()) {
-            return {};
-        }
-        return synonym_to_values.at(synonym->get_name_string());
-    }
+        -> std::unordered_set<std::string>;
 };
 
 using OutputTable = std::variant<Table, UnitTable>;
@@ -72,18 +119,20 @@ using OutputTable = std::variant<Table, UnitTable>;
 auto is_empty(const OutputTable& table) -> bool;
 auto is_unit(const OutputTable& table) -> bool;
 
-template <class T>
-void reorder(std::vector<T>& v, std::vector<int> const& order) {
-    std::vector<T> v_copy(order.size());
-    for (size_t s = 0; s < order.size(); ++s) {
-        v_copy[s] = v[order[s]];
-    }
-
-    v = v_copy;
-}
+// Supplies the values a synonym may take when an anti-join extends a table with it, as ids of the given dictionary
+using Domain =
+    std::function<std::vector<ValueId>(const std::shared_ptr<Synonym>&, const std::shared_ptr<ValueDictionary>&)>;
 
+/**
+ * Anti-join: the rows of table1, extended with every domain value of the synonyms only table2 has, that match no row
+ * of table2. Candidate rows are probed against table2 as they are generated, so the extended table is never built.
+ * Tables without common synonyms are left as they are.
+ */
+auto anti_join(OutputTable&& table1, Table&& table2, const Domain& domain) -> Table;
 auto subtract(OutputTable&& table1, OutputTable&& table2, const std::shared_ptr<pkb::ReadFacade>& read_facade) -> Table;
 auto join(OutputTable&& table1, OutputTable&& table2) -> OutputTable;
+// Leaves out the columns of the given synonyms, keeping each distinct row of the remaining columns once
+auto drop_columns(OutputTable&& table, const Synonyms& synonyms) -> OutputTable;
 auto project_to_table(const std::shared_ptr<pkb::ReadFacade>& read_facade, OutputTable& table,
                       const Reference& reference, bool should_transform = false) -> OutputTable;
 auto project(const std::shared_ptr<pkb::ReadFacade>& read_facade, OutputTable& table, const Reference& reference)
@@ -107,20 +156,14 @@ class AttributeExtractor {
             },
             [read_facade](const AttrRef& attr_ref) -> std::function<std::string(const std::string&)> {
                 const auto synonym = attr_ref.synonym;
-                if (std::dynamic_pointer_cast<PrintSynonym>(synonym) &&
-                    std::holds_alternative<VarName>(attr_ref.attr_name)) {
-                    return [read_facade](const std::string& x) -> std::string {
-                        return *read_facade->get_vars_used_by_statement(x).begin();
-                    };
-                } else if (std::dynamic_pointer_cast<ReadSynonym>(synonym) &&
-                           std::holds_alternative<VarName>(attr_ref.attr_name)) {
-                    return [read_facade](const std::string& x) -> std::string {
-                        return *read_facade->get_vars_modified_by_statement(x).begin();
-                    };
-                } else if (std::dynamic_pointer_cast<CallSynonym>(synonym) &&
-                           std::holds_alternative<ProcName>(attr_ref.attr_name)) {
+                const auto is_read_or_print =
+                    std::dynamic_pointer_cast<ReadSynonym>(synonym) || std::dynamic_pointer_cast<PrintSynonym>(synonym);
+                const auto is_call = std::dynamic_pointer_cast<CallSynonym>(synonym) != nullptr;
+                // Name attributes of statements are precomputed by the PKB when it is finalised
+                if ((is_read_or_print && std::holds_alternative<VarName>(attr_ref.attr_name)) ||
+                    (is_call && std::holds_alternative<ProcName>(attr_ref.attr_name))) {
                     return [read_facade](const std::string& x) -> std::string {
-                        return read_facade->get_procedure_name_called_by(x);
+                        return read_facade->get_statement_name_attribute(x);
                     };
                 } else {
                     return [](const std::string& x) -> std::string {
@@ -140,9 +183,16 @@ auto double_pointer_merge(std::vector<std::shared_ptr<Synonym>> column1, std::ve
     -> std::vector<std::shared_ptr<Synonym>>;
 
 // Join strategies
+enum class JoinStrategy { Cross, Merge, Hash };
+
 auto cross_join(Table&& table1, Table&& table2) -> OutputTable;
 auto merge_join(Table&& table1, Table&& table2) -> OutputTable;
 auto cross_merge_join(Table&& table1, Table&& table2) -> OutputTable;
+auto hash_join(Table&& table1, Table&& table2) -> OutputTable;
+
+// Picks the cheapest strategy from the common columns, the cardinalities and the existing sort orders
+auto select_join_strategy(const Table& table1, const Table& table2) -> JoinStrategy;
+auto adaptive_join(Table&& table1, Table&& table2) -> OutputTable;
 
 } // namespace detail
 } // namespace qps
\ No newline at end of file
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace qps {
+
+using ValueId = std::uint32_t;
+
+/**
+ * Encodes the values held in result tables as dense ids; values are decoded back to strings only when results are
+ * projected. Tables only compare ids for equality and order, so a table refers to the dictionary its ids come from.
+ *
+ * Each group of a query is evaluated on one thread with its own dictionary, which therefore needs no locking and is
+ * released together with the last table that refers to it.
+ */
+class ValueDictionary {
+    std::unordered_map<std::string, ValueId> ids;
+    std::deque<std::string> values; // A deque never moves its elements, so decoded references stay valid
+
+  public:
+    // Makes the tables created on this thread use the given dictionary until the scope ends
+    class Scope {
+        std::shared_ptr<ValueDictionary> previous;
+
+      public:
+        explicit Scope(std::shared_ptr<ValueDictionary> dictionary);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        auto operator=(const Scope&) -> Scope& = delete;
+    };
+
+    ValueDictionary() = default;
+    ValueDictionary(const ValueDictionary&) = delete;
+    auto operator=(const ValueDictionary&) -> ValueDictionary& = delete;
+
+    // The dictionary of the innermost scope on this thread, or a new one outside of any scope
+    static auto current() -> std::shared_ptr<ValueDictionary>;
+
+    auto encode(const std::string& value) -> ValueId;
+
+    [[nodiscard]] auto decode(ValueId id) const -> const std::string&;
+};
+} // namespace qps
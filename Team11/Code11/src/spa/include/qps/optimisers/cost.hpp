@@ -0,0 +1,29 @@
+#pragma once
+
+#include "pkb/facades/read_facade.h"
+#include "qps/optimisers/optimiser.hpp"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace qps {
+
+/**
+ * Orders the clauses of each query by their estimated cost, using the cardinalities kept by the PKB.
+ *
+ * Clauses are picked greedily: the next clause is the one with the smallest estimated result once the synonyms bound
+ * by the earlier clauses are taken into account. Next* and Affects are computed at query time, so they are penalised
+ * and end up evaluated with the smallest DataSource possible.
+ */
+class CostOptimiser : public Optimiser {
+    std::shared_ptr<pkb::ReadFacade> read_facade;
+
+    [[nodiscard]] auto optimise(const Query& query) const -> std::vector<Query> override;
+
+  public:
+    explicit CostOptimiser(std::shared_ptr<pkb::ReadFacade> read_facade) : read_facade(std::move(read_facade)) {
+    }
+};
+
+} // namespace qps
@@ -2,6 +2,8 @@
 
 #include "qps/optimisers/optimiser.hpp"
 
+#include "pkb/facades/read_facade.h"
+#include "qps/optimisers/cost.hpp"
 #include "qps/optimisers/grouping.hpp"
 #include "qps/optimisers/opposite.hpp"
 #include "qps/optimisers/priority.hpp"
@@ -26,10 +28,7 @@ static auto has_contradiction(const std::vector<Query>& queries) -> bool {
 }
 
 class DefaultOptimiser : public Optimiser {
-    const std::array<std::shared_ptr<Optimiser>, 5> optimisers = {
-        std::make_shared<RedundancyOptimiser>(), std::make_shared<OppositeOptimiser>(),
-        std::make_shared<SubsumptionRewriteOptimiser>(), std::make_shared<GroupingOptimiser>(),
-        std::make_shared<PriorityOptimiser>()};
+    const std::array<std::shared_ptr<Optimiser>, 6> optimisers;
 
     [[nodiscard]] auto optimise(const Query& query) const -> std::vector<Query> override {
         auto optimised_queries = std::vector<Query>{query};
@@ -49,5 +48,12 @@ class DefaultOptimiser : public Optimiser {
         }
         return optimised_queries;
     }
+
+  public:
+    explicit DefaultOptimiser(const std::shared_ptr<pkb::ReadFacade>& read_facade)
+        : optimisers{std::make_shared<RedundancyOptimiser>(), std::make_shared<OppositeOptimiser>(),
+                     std::make_shared<SubsumptionRewriteOptimiser>(), std::make_shared<GroupingOptimiser>(),
+                     std::make_shared<CostOptimiser>(read_facade), std::make_shared<PriorityOptimiser>()} {
+    }
 };
 } // namespace qps
@@ -2,10 +2,15 @@
 
 #include "qps/optimisers/optimiser.hpp"
 
+#include <memory>
+
 namespace qps {
 
 class GroupingOptimiser : public Optimiser {
     [[nodiscard]] auto optimise(const Query& query) const -> std::vector<Query> override;
 };
 
+// The synonyms a clause refers to, which connect it to the other clauses of its group
+auto get_synonyms(const std::shared_ptr<Clause>& clause) -> Synonyms;
+
 } // namespace qps
\ No newline at end of file
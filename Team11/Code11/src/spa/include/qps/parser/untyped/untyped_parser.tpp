@@ -54,7 +54,7 @@ class UntypedParser {
     static auto parse(std::string query) -> std::variant<std::tuple<Synonyms, UntypedQueryType>, SyntaxError> {
         const auto maybe_tokens = [&query]() -> std::variant<std::vector<Token>, SyntaxError> {
             try {
-                return tokeniser_runner.apply_tokeniser(std::move(query));
+                return tokeniser_runner.apply_tokeniser(query);
             } catch (const std::exception& e) {
                 return SyntaxError{e.what()};
             }
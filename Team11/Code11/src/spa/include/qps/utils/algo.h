@@ -1,11 +1,16 @@
 #pragma once
 
+#include <functional>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
 #include "common/hashable_tuple.h"
+#include "pkb/common_types/set_view.h"
+
+// Returns the nodes directly reachable from a node, without copying the underlying graph
+using Neighbours = std::function<SetView<std::string>(const std::string&)>;
 
 // Given one unordered set of strings, create all permutations of the set
 std::vector<std::pair<std::string, std::string>> create_permutations(const std::unordered_set<std::string>& set);
@@ -56,6 +61,37 @@ bool has_transitive_rs(
 
 std::unordered_set<std::string> get_all_transitive_from_node(
     const std::string& node, const std::unordered_map<std::string, std::unordered_set<std::string>>& map,
+    const std::function<bool(const std::string&)>& start_node_cond =
+        [](const std::string&) {
+            return true;
+        },
+    const std::function<bool(const std::string&)>& end_node_cond =
+        [](const std::string&) {
+            return true;
+        },
+    const std::function<bool(const std::string&)>& intermediate_node_cond =
+        [](const std::string&) {
+            return true;
+        });
+
+// Same as above, but traversing the graph through a non-copying view
+bool has_transitive_rs(
+    const std::string& node1, const std::unordered_set<std::string>& end_nodes, const Neighbours& neighbours,
+    const std::function<bool(const std::string&)>& start_node_cond =
+        [](const std::string&) {
+            return true;
+        },
+    const std::function<bool(const std::string&)>& end_node_cond =
+        [](const std::string&) {
+            return true;
+        },
+    const std::function<bool(const std::string&)>& intermediate_node_cond =
+        [](const std::string&) {
+            return true;
+        });
+
+std::unordered_set<std::string> get_all_transitive_from_node(
+    const std::string& node, const Neighbours& neighbours,
     const std::function<bool(const std::string&)>& start_node_cond =
         [](const std::string&) {
             return true;
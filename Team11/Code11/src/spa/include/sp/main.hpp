@@ -1,17 +1,20 @@
 #pragma once
 
 #include "common/tokeniser/runner.hpp"
+#include "common/tokeniser/source_file.hpp"
 
 #include "common/ast/ast.hpp"
 #include "sp/cfg/program_cfgs.hpp"
 #include "sp/parser/parser.hpp"
 #include "sp/parser/program_parser.hpp"
+#include "sp/tokeniser/lexer.hpp"
 #include "sp/tokeniser/tokeniser.hpp"
 #include "sp/traverser/affects_traverser.hpp"
 #include "sp/traverser/design_entites_populator_traverser.hpp"
 #include "sp/traverser/follows_traverser.hpp"
 #include "sp/traverser/modifies_traverser.hpp"
 #include "sp/traverser/next_traverser.hpp"
+#include "sp/traverser/parallel_extractor.hpp"
 #include "sp/traverser/parent_traverser.hpp"
 #include "sp/traverser/stmt_num_traverser.hpp"
 #include "sp/traverser/traverser.hpp"
@@ -43,6 +46,16 @@ class SourceProcessor {
     std::shared_ptr<pkb::WriteFacade> write_facade;
     SemanticValidator semantic_validator{};
     CallGraphTraverser call_graph_traverser;
+    std::shared_ptr<ParallelExtractor> parallel_extractor;
+    // Batched facade the traversers write into, committed to the PKB in bulk before it is finalised
+    std::shared_ptr<pkb::WriteFacade> batch_facade;
+
+    static auto get_tokenizer(TokenizerEngine engine) -> std::unique_ptr<Tokenizer> {
+        if (engine == TokenizerEngine::Dfa) {
+            return std::make_unique<SourceProcessorLexer>();
+        }
+        return std::make_unique<SourceProcessorTokenizer>();
+    }
 
   public:
     SourceProcessor(std::shared_ptr<TokenizerRunner> tr, std::shared_ptr<Parser> parser,
@@ -65,18 +78,25 @@ class SourceProcessor {
           write_facade(write_facade), call_graph_traverser(write_facade) {
     }
 
-    static auto get_complete_sp(const std::shared_ptr<pkb::WriteFacade>& write_facade)
-        -> std::shared_ptr<SourceProcessor> {
-        return std::make_shared<SourceProcessor>(
-            std::make_shared<tokenizer::TokenizerRunner>(std::make_unique<SourceProcessorTokenizer>(), true),
-            std::make_shared<ProgramParser>(), std::make_shared<StmtNumTraverser>(write_facade),
+    static auto get_complete_sp(const std::shared_ptr<pkb::WriteFacade>& write_facade,
+                                TokenizerEngine engine = TokenizerEngine::Combinator,
+                                ExtractionMode mode = ExtractionMode::Serial) -> std::shared_ptr<SourceProcessor> {
+        auto batch_facade = write_facade->create_batch();
+        auto source_processor = std::make_shared<SourceProcessor>(
+            std::make_shared<tokenizer::TokenizerRunner>(get_tokenizer(engine), true),
+            std::make_shared<ProgramParser>(), std::make_shared<StmtNumTraverser>(batch_facade),
             std::make_shared<ProgramCfgs>(),
             std::vector<std::shared_ptr<Traverser>>{
-                std::make_shared<DesignEntitiesPopulatorTraverser>(write_facade),
-                std::make_shared<ModifiesTraverser>(write_facade), std::make_shared<ParentTraverser>(write_facade),
-                std::make_shared<UsesTraverser>(write_facade), std::make_shared<FollowsTraverser>(write_facade)},
-            std::make_shared<NextTraverser>(write_facade), std::make_shared<AffectsTraverser>(write_facade),
+                std::make_shared<DesignEntitiesPopulatorTraverser>(batch_facade),
+                std::make_shared<ModifiesTraverser>(batch_facade), std::make_shared<ParentTraverser>(batch_facade),
+                std::make_shared<UsesTraverser>(batch_facade), std::make_shared<FollowsTraverser>(batch_facade)},
+            std::make_shared<NextTraverser>(batch_facade), std::make_shared<AffectsTraverser>(batch_facade),
             write_facade);
+        source_processor->batch_facade = batch_facade;
+        if (mode == ExtractionMode::Parallel) {
+            source_processor->parallel_extractor = std::make_shared<ParallelExtractor>(write_facade);
+        }
+        return source_processor;
     }
 
     static auto output_xml(const std::shared_ptr<AstNode>& ast_node) -> std::string {
@@ -103,10 +123,17 @@ class SourceProcessor {
     }
 
     auto process(std::string& input) -> std::shared_ptr<AstNode> {
-
         // Step 1. Tokenise SIMPLE
-        const auto tokens = tokenizer_runner->apply_tokeniser(std::move(input));
+        return process_tokens(tokenizer_runner->apply_tokeniser(input));
+    }
+
+    auto process(SourceFile& source) -> std::shared_ptr<AstNode> {
+        // Step 1. Tokenise SIMPLE straight from the mapped file
+        return process_tokens(tokenizer_runner->apply_tokeniser(source));
+    }
 
+  private:
+    auto process_tokens(const std::vector<Token>& tokens) -> std::shared_ptr<AstNode> {
         // Step 2. Parse tokens
         auto it = tokens.begin();
         auto ast = parser->parse(it, tokens.end());
@@ -116,22 +143,31 @@ class SourceProcessor {
         auto procedure_topology_orders = semantic_validator.validate_get_traversal_order(ast);
         // Step 3.2 Execute Statement Number Traverser （Update AST)
         ast = stmt_num_traverser->traverse(ast, procedure_topology_orders);
-        // Step 3.3 Build CFG
-        auto cfgs = program_cfgs->build(ast);
-        // Step 3.4 Extract Call Graph
+        // Step 3.3 Extract Call Graph
         call_graph_traverser.traverse(semantic_validator.get_call_graph());
 
-        // Step 4. Execute Design Abstraction Traversers (Update AST)
-        for (const auto& traverser : design_abstr_traversers) {
-            ast = traverser->traverse(ast, procedure_topology_orders);
+        if (parallel_extractor != nullptr) {
+            // Step 4 & 5. Build the CFGs and execute all traversers procedure by procedure
+            parallel_extractor->extract(ast, procedure_topology_orders, semantic_validator.get_call_graph());
+        } else {
+            // Step 3.4 Build CFG
+            auto cfgs = program_cfgs->build(ast);
+
+            // Step 4. Execute Design Abstraction Traversers (Update AST)
+            for (const auto& traverser : design_abstr_traversers) {
+                ast = traverser->traverse(ast, procedure_topology_orders);
+            }
+
+            // Step 5. Execute Next & Affects Traverser
+            next_traverser->traverse(cfgs);
+            affects_traverser->traverse(cfgs);
         }
 
-        // Step 5. Execute Next & Affects Traverser
-        next_traverser->traverse(cfgs);
-        affects_traverser->traverse(cfgs);
-
-        // Step 6. If writing to pkb, finalise pkb.
+        // Step 6. If writing to pkb, load the batched writes in bulk and finalise pkb.
         if (write_facade != nullptr) {
+            if (batch_facade != nullptr) {
+                write_facade->commit(*batch_facade);
+            }
             write_facade->finalise_pkb(procedure_topology_orders);
         }
 
@@ -0,0 +1,206 @@
+#pragma once
+
+#include "common/tokeniser/token_types.hpp"
+#include "common/tokeniser/tokenizer.hpp"
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+namespace sp {
+using namespace tokenizer;
+
+/**
+ * @brief Selects the tokenizer used by the SourceProcessor.
+ */
+enum class TokenizerEngine {
+    // The composed SourceProcessorTokenizer
+    Combinator,
+    // The table-driven SourceProcessorLexer
+    Dfa,
+};
+
+/**
+ * @class SourceProcessorLexer
+ * @brief Table-driven DFA lexer for SIMPLE.
+ *
+ * Recognises the same tokens as SourceProcessorTokenizer in a single pass over the input: every character is mapped
+ * to a character class, the DFA is run until it gets stuck, and the token of the last accepting state is returned
+ * (maximal munch). Runs of junk characters are consumed as a single Junk token.
+ */
+class SourceProcessorLexer : public Tokenizer {
+  private:
+    enum CharClass : std::uint8_t {
+        Other,
+        Letter,
+        Zero,
+        NonZeroDigit,
+        LParen,
+        RParen,
+        LCurly,
+        RCurly,
+        Semicolon,
+        Less,
+        Greater,
+        Equal,
+        Bang,
+        Ampersand,
+        Pipe,
+        Plus,
+        Minus,
+        Star,
+        Slash,
+        Percent,
+        Space,
+        NumCharClasses,
+    };
+
+    enum State : std::uint8_t {
+        Error,
+        Start,
+        ZeroInteger,
+        Integer,
+        Name,
+        LParenSeen,
+        RParenSeen,
+        LCurlySeen,
+        RCurlySeen,
+        SemicolonSeen,
+        LessSeen,
+        LessEqualSeen,
+        GreaterSeen,
+        GreaterEqualSeen,
+        EqualSeen,
+        DoubleEqualSeen,
+        BangSeen,
+        NotEqualSeen,
+        AmpersandSeen,
+        AndSeen,
+        PipeSeen,
+        OrSeen,
+        PlusSeen,
+        MinusSeen,
+        StarSeen,
+        SlashSeen,
+        PercentSeen,
+        Junk,
+        NumStates,
+    };
+
+    using CharClassTable = std::array<CharClass, std::numeric_limits<unsigned char>::max() + 1>;
+    using TransitionTable = std::array<std::array<State, NumCharClasses>, NumStates>;
+
+    struct Accept {
+        bool accepting;
+        TokenType type;
+    };
+
+    using AcceptTable = std::array<Accept, NumStates>;
+
+    static constexpr auto char_classes = []() {
+        auto table = CharClassTable{};
+        for (auto c = 'a'; c <= 'z'; c++) {
+            table[static_cast<unsigned char>(c)] = Letter;
+            table[static_cast<unsigned char>(c - 'a' + 'A')] = Letter;
+        }
+        table['0'] = Zero;
+        for (auto c = '1'; c <= '9'; c++) {
+            table[static_cast<unsigned char>(c)] = NonZeroDigit;
+        }
+        table['('] = LParen;
+        table[')'] = RParen;
+        table['{'] = LCurly;
+        table['}'] = RCurly;
+        table[';'] = Semicolon;
+        table['<'] = Less;
+        table['>'] = Greater;
+        table['='] = Equal;
+        table['!'] = Bang;
+        table['&'] = Ampersand;
+        table['|'] = Pipe;
+        table['+'] = Plus;
+        table['-'] = Minus;
+        table['*'] = Star;
+        table['/'] = Slash;
+        table['%'] = Percent;
+        for (auto c : {' ', '\n', '\t', '\v', '\f', '\r'}) {
+            table[static_cast<unsigned char>(c)] = Space;
+        }
+        return table;
+    }();
+
+    static constexpr auto transitions = []() {
+        auto table = TransitionTable{};
+        auto& start = table[Start];
+        start[Letter] = Name;
+        start[Zero] = ZeroInteger;
+        start[NonZeroDigit] = Integer;
+        start[LParen] = LParenSeen;
+        start[RParen] = RParenSeen;
+        start[LCurly] = LCurlySeen;
+        start[RCurly] = RCurlySeen;
+        start[Semicolon] = SemicolonSeen;
+        start[Less] = LessSeen;
+        start[Greater] = GreaterSeen;
+        start[Equal] = EqualSeen;
+        start[Bang] = BangSeen;
+        start[Ampersand] = AmpersandSeen;
+        start[Pipe] = PipeSeen;
+        start[Plus] = PlusSeen;
+        start[Minus] = MinusSeen;
+        start[Star] = StarSeen;
+        start[Slash] = SlashSeen;
+        start[Percent] = PercentSeen;
+        start[Space] = Junk;
+
+        // Integers have no leading zeros, so a zero is always an integer on its own
+        table[Integer][Zero] = Integer;
+        table[Integer][NonZeroDigit] = Integer;
+        table[Name][Letter] = Name;
+        table[Name][Zero] = Name;
+        table[Name][NonZeroDigit] = Name;
+
+        table[LessSeen][Equal] = LessEqualSeen;
+        table[GreaterSeen][Equal] = GreaterEqualSeen;
+        table[EqualSeen][Equal] = DoubleEqualSeen;
+        table[BangSeen][Equal] = NotEqualSeen;
+        table[AmpersandSeen][Ampersand] = AndSeen;
+        table[PipeSeen][Pipe] = OrSeen;
+
+        table[Junk][Space] = Junk;
+        return table;
+    }();
+
+    static constexpr auto accepts = []() {
+        auto table = AcceptTable{};
+        table[ZeroInteger] = {true, TokenType::Integer};
+        table[Integer] = {true, TokenType::Integer};
+        table[Name] = {true, TokenType::String};
+        table[LParenSeen] = {true, TokenType::LParen};
+        table[RParenSeen] = {true, TokenType::RParen};
+        table[LCurlySeen] = {true, TokenType::LCurly};
+        table[RCurlySeen] = {true, TokenType::RCurly};
+        table[SemicolonSeen] = {true, TokenType::Semicolon};
+        table[LessSeen] = {true, TokenType::LessThan};
+        table[LessEqualSeen] = {true, TokenType::LessThanEqual};
+        table[GreaterSeen] = {true, TokenType::GreaterThan};
+        table[GreaterEqualSeen] = {true, TokenType::GreaterThanEqual};
+        table[EqualSeen] = {true, TokenType::Assignment};
+        table[DoubleEqualSeen] = {true, TokenType::DoubleEqual};
+        table[BangSeen] = {true, TokenType::LNot};
+        table[NotEqualSeen] = {true, TokenType::NotEqual};
+        table[AndSeen] = {true, TokenType::LAnd};
+        table[OrSeen] = {true, TokenType::LOr};
+        table[PlusSeen] = {true, TokenType::Add};
+        table[MinusSeen] = {true, TokenType::Sub};
+        table[StarSeen] = {true, TokenType::Mul};
+        table[SlashSeen] = {true, TokenType::Div};
+        table[PercentSeen] = {true, TokenType::Mod};
+        table[Junk] = {true, TokenType::Junk};
+        return table;
+    }();
+
+  public:
+    [[nodiscard]] auto tokenize(const TokeniserInput& input) const -> TokeniserOutput override;
+};
+} // namespace sp
@@ -8,6 +8,8 @@ namespace sp {
 
 class NextTraverser {
     std::shared_ptr<pkb::WriteFacade> write_facade;
+    // Next pairs found by the current traversal, written to the PKB in one bulk write
+    pkb::WriteBatch::Pairs next_pairs;
 
   private:
     auto traverse_node(const std::shared_ptr<CfgNode>& node) -> void;
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "common/ast/ast.hpp"
+#include "common/ast/procedure_ast.hpp"
+#include "common/utils/thread_pool.hpp"
+#include "pkb/facades/write_facade.h"
+#include "sp/cfg/program_cfgs.hpp"
+#include "sp/validator/semantic_validator.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sp {
+
+/**
+ * @brief Selects how the SourceProcessor extracts design abstractions.
+ */
+enum class ExtractionMode {
+    // Run every traverser over the whole program, one after another
+    Serial,
+    // Extract procedures concurrently with a ParallelExtractor
+    Parallel,
+};
+
+/**
+ * @class ParallelExtractor
+ * @brief Extracts the design abstractions of a program with one task per procedure.
+ *
+ * Entities, Follows, Parent, the CFG, Next and the Affects statement mapping only depend on the procedure itself, so
+ * all procedures are processed concurrently. Modifies and Uses of a procedure depend on the procedures it calls, so
+ * procedures are grouped into wavefronts where every callee is in an earlier wavefront, and each wavefront is
+ * processed concurrently. Every worker writes into its own batched WriteFacade, and the batches are committed to the
+ * PKB once extraction is done.
+ */
+class ParallelExtractor {
+    std::shared_ptr<pkb::WriteFacade> write_facade;
+    std::unique_ptr<ThreadPool> thread_pool;
+
+    using Procedures = std::vector<std::shared_ptr<ProcedureNode>>;
+
+    static auto get_wavefronts(const Procedures& procedures, const std::vector<std::string>& proc_topo_sort,
+                               const SemanticValidator::CallGraph& call_graph) -> std::vector<Procedures>;
+
+  public:
+    explicit ParallelExtractor(std::shared_ptr<pkb::WriteFacade> write_facade,
+                               std::size_t num_threads = std::thread::hardware_concurrency());
+
+    /**
+     * @brief Extracts every design abstraction of the program into the PKB.
+     * @return The CFG of every procedure.
+     */
+    auto extract(const std::shared_ptr<AstNode>& ast, const std::vector<std::string>& proc_topo_sort,
+                 const SemanticValidator::CallGraph& call_graph) -> ProcMap;
+};
+} // namespace sp
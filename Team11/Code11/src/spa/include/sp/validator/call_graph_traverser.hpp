@@ -22,11 +22,13 @@ class CallGraphTraverser {
             return;
         }
 
+        auto calls = pkb::WriteBatch::Pairs{};
         for (const auto& [callee, callers] : call_graph) {
             for (const auto& caller : callers) {
-                write_facade->add_calls(caller, callee);
+                calls.emplace_back(caller, callee);
             }
         }
+        write_facade->add_all_calls(std::move(calls));
     };
 };
 
@@ -1,6 +1,17 @@
 #include "common/ast/procedure_ast.hpp"
 
 namespace sp {
+auto ProcedureNode::store_proc_vars(std::unordered_map<std::string, std::unordered_set<std::string>>& map,
+                                    const std::string& proc_name, const std::unordered_set<std::string>& vars) -> void {
+    // Procedures processed in parallel have their entries inserted beforehand, so only the entry is written here
+    auto entry = map.find(proc_name);
+    if (entry != map.end()) {
+        entry->second = vars;
+        return;
+    }
+    map.insert(std::make_pair(proc_name, vars));
+}
+
 auto ProcedureNode::populate_pkb_entities(const std::shared_ptr<pkb::WriteFacade>& write_facade) const -> void {
     write_facade->add_procedure(proc_name);
 }
@@ -47,7 +58,7 @@ auto ProcedureNode::populate_pkb_modifies(const std::shared_ptr<pkb::WriteFacade
         write_facade->add_procedure_modify_var(proc_name, var);
     }
 
-    modify_map->insert(std::make_pair(proc_name, combined_set));
+    store_proc_vars(*modify_map, proc_name, combined_set);
     return combined_set;
 }
 
@@ -78,7 +89,7 @@ auto ProcedureNode::populate_pkb_uses(const std::shared_ptr<pkb::WriteFacade>& w
     for (const auto& var_name : var_names_stmt_list) {
         write_facade->add_procedure_use_var(proc_name, var_name);
     }
-    uses_map->insert(std::make_pair(proc_name, var_names_stmt_list));
+    store_proc_vars(*uses_map, proc_name, var_names_stmt_list);
     return var_names_stmt_list;
 }
 } // namespace sp
\ No newline at end of file
@@ -6,23 +6,40 @@
 
 using namespace tokenizer;
 
-auto TokenizerRunner::apply_tokeniser(std::string input, bool debug) const -> std::vector<Token> {
+auto TokenizerRunner::apply_tokeniser(std::string_view input, bool debug) const -> std::vector<Token> {
+    return tokenize_all(input, debug, nullptr);
+}
+
+auto TokenizerRunner::apply_tokeniser(SourceFile& source, bool debug) const -> std::vector<Token> {
+    return tokenize_all(source.view(), debug, &source);
+}
+
+auto TokenizerRunner::tokenize_all(std::string_view input, bool debug, SourceFile* source) const
+    -> std::vector<Token> {
     std::vector<Token> result{};
+    auto cursor = TokeniserInput{input};
+    auto next_release = SOURCE_CHUNK_SIZE;
 
-    while (!input.empty()) {
-        const auto res = tokenizer->tokenize(input);
+    while (!cursor.empty()) {
+        const auto res = tokenizer->tokenize(cursor);
         if (!res.has_value()) {
             std::stringstream error_message;
             error_message << "Tokeniser error!\n"
-                          << "Found unexpected token: " << input.substr(0, input.find('\n')) << std::endl;
+                          << "Found unexpected token: " << cursor.substr(0, cursor.find('\n')) << std::endl;
             throw std::runtime_error(error_message.str());
         } else {
             const auto& [res_success, rest] = res.value();
-            input = rest;
+            cursor = rest;
             if (res_success.T != TokenType::Junk) {
                 push_token(debug, result, res_success);
             }
         }
+
+        const auto consumed = input.length() - cursor.length();
+        if (source != nullptr && consumed >= next_release) {
+            source->release_until(consumed);
+            next_release = consumed + SOURCE_CHUNK_SIZE;
+        }
     }
 
     if (include_done) {
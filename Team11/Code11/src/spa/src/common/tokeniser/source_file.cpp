@@ -0,0 +1,86 @@
+#include "common/tokeniser/source_file.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <fstream>
+#include <iterator>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace tokenizer {
+#ifdef _WIN32
+SourceFile::SourceFile(const std::string& filename) {
+    if (!std::filesystem::exists(filename)) {
+        throw std::runtime_error("Error: File does not exist");
+    }
+
+    std::ifstream file{filename, std::ios::binary};
+    if (!file.is_open()) {
+        throw std::runtime_error("Error: Unable to open file");
+    }
+
+    buffer = {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    data = buffer.data();
+    length = buffer.length();
+}
+
+SourceFile::~SourceFile() = default;
+
+void SourceFile::release_until(std::size_t) {
+}
+#else
+SourceFile::SourceFile(const std::string& filename) {
+    if (!std::filesystem::exists(filename)) {
+        throw std::runtime_error("Error: File does not exist");
+    }
+
+    const auto fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Error: Unable to open file");
+    }
+
+    length = std::filesystem::file_size(filename);
+    if (length == 0) {
+        close(fd);
+        return;
+    }
+
+    auto* mapping = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        throw std::runtime_error("Error: Unable to map file");
+    }
+
+    madvise(mapping, length, MADV_SEQUENTIAL);
+    data = static_cast<const char*>(mapping);
+}
+
+SourceFile::~SourceFile() {
+    if (data != nullptr) {
+        munmap(const_cast<char*>(data), length);
+    }
+}
+
+void SourceFile::release_until(std::size_t offset) {
+    static const auto page_size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+
+    const auto end = std::min(offset, length) / page_size * page_size;
+    if (data == nullptr || end <= released) {
+        return;
+    }
+
+    madvise(const_cast<char*>(data) + released, end - released, MADV_DONTNEED);
+    released = end;
+}
+#endif
+
+auto SourceFile::view() const -> std::string_view {
+    return {data, length};
+}
+} // namespace tokenizer
@@ -2,39 +2,28 @@
 #include <optional>
 
 namespace tokenizer {
-auto Tokenizer::tokenize_string(TokeniserInput input, std::string token, TokenType token_type)
+auto Tokenizer::tokenize_string(TokeniserInput input, std::string_view token, TokenType token_type)
     -> Tokenizer::TokeniserOutput {
-    if (input.length() < token.length()) {
+    if (input.substr(0, token.length()) != token) {
         return std::nullopt;
     }
 
-    for (std::string::size_type i = 0; i < token.length(); i++) {
-        if (input[i] != token[i]) {
-            return std::nullopt;
-        }
-    }
-
-    return std::make_tuple(Token{token_type, token}, input.substr(token.length()));
+    return std::make_tuple(Token{token_type, std::string{token}}, input.substr(token.length()));
 }
 
 auto Tokenizer::zero_or_more(const TokeniserInput& input, const std::shared_ptr<Tokenizer>& tokenisers, TokenType type)
     -> Tokenizer::TokeniserOutput {
-    const auto result = tokenisers->tokenize(input);
-    if (!result.has_value()) {
-        return std::make_tuple(Token{type, ""}, input);
-    }
-
-    auto [success, rest] = result.value();
+    auto rest = input;
     while (true) {
         const auto maybe_next = tokenisers->tokenize(rest);
         if (!maybe_next.has_value()) {
-            return std::make_tuple(success, rest);
+            break;
         }
-
-        const auto& [next_token, rem] = maybe_next.value();
-        success = Token{next_token.T, success.content + next_token.content};
-        rest = rem;
+        rest = std::get<1>(maybe_next.value());
     }
+
+    const auto consumed = input.substr(0, input.length() - rest.length());
+    return std::make_tuple(Token{type, std::string{consumed}}, rest);
 }
 
 } // namespace tokenizer
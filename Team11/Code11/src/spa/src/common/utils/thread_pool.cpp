@@ -0,0 +1,86 @@
+#include "common/utils/thread_pool.hpp"
+
+#include <algorithm>
+
+ThreadPool::ThreadPool(std::size_t num_threads) {
+    num_threads = std::max<std::size_t>(num_threads, 1);
+    workers.reserve(num_threads);
+    for (std::size_t worker = 0; worker < num_threads; worker++) {
+        workers.emplace_back([this, worker]() {
+            work(worker);
+        });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        const auto lock = std::lock_guard{mutex};
+        stopping = true;
+    }
+    job_ready.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+auto ThreadPool::size() const -> std::size_t {
+    return workers.size();
+}
+
+void ThreadPool::parallel_for(std::size_t num_tasks, const Task& new_task) {
+    if (num_tasks == 0) {
+        return;
+    }
+
+    auto lock = std::unique_lock{mutex};
+    task = &new_task;
+    count = num_tasks;
+    next_index = 0;
+    error = nullptr;
+    busy_workers = workers.size();
+    generation++;
+    job_ready.notify_all();
+
+    job_done.wait(lock, [this]() {
+        return busy_workers == 0;
+    });
+    task = nullptr;
+
+    if (error != nullptr) {
+        std::rethrow_exception(error);
+    }
+}
+
+void ThreadPool::work(std::size_t worker) {
+    auto seen_generation = std::size_t{0};
+    while (true) {
+        auto lock = std::unique_lock{mutex};
+        job_ready.wait(lock, [this, seen_generation]() {
+            return stopping || generation != seen_generation;
+        });
+        if (stopping) {
+            return;
+        }
+        seen_generation = generation;
+        const auto* current_task = task;
+        const auto num_tasks = count;
+        lock.unlock();
+
+        for (auto index = next_index++; index < num_tasks; index = next_index++) {
+            try {
+                (*current_task)(index, worker);
+            } catch (...) {
+                const auto error_lock = std::lock_guard{mutex};
+                if (error == nullptr) {
+                    error = std::current_exception();
+                }
+            }
+        }
+
+        lock.lock();
+        busy_workers--;
+        if (busy_workers == 0) {
+            job_done.notify_one();
+        }
+    }
+}
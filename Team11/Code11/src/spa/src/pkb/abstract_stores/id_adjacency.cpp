@@ -0,0 +1,104 @@
+#include "pkb/abstract_stores/id_adjacency.h"
+
+#include <algorithm>
+
+IdAdjacency::IdAdjacency() = default;
+
+IdAdjacency::IdAdjacency(std::size_t num_rows, std::size_t num_cols, std::vector<Edge> edges, bool index_dense_rows)
+    : offsets(num_rows + 1, 0) {
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+    // Count the edges of every row, then prefix sum into row offsets
+    for (const auto& [row, _] : edges) {
+        offsets[row + 1]++;
+    }
+    for (std::size_t row = 0; row < num_rows; row++) {
+        offsets[row + 1] += offsets[row];
+    }
+
+    // Edges are sorted by row then column, so the columns are already laid out row by row
+    cols.reserve(edges.size());
+    for (const auto& [_, col] : edges) {
+        cols.push_back(col);
+    }
+
+    if (index_dense_rows) {
+        build_bitsets(num_cols);
+    }
+}
+
+void IdAdjacency::build_bitsets(std::size_t num_cols) {
+    words_per_row = (num_cols + BITS_PER_WORD - 1) / BITS_PER_WORD;
+    if (words_per_row == 0) {
+        return;
+    }
+
+    const auto num_rows = get_num_rows();
+    bitset_of_row.assign(num_rows, NO_BITSET);
+    SymbolId num_bitsets = 0;
+    for (std::size_t row = 0; row < num_rows; row++) {
+        const auto degree = offsets[row + 1] - offsets[row];
+        // A bitset costs num_cols bits, the column list costs 32 bits per column
+        if (degree * sizeof(SymbolId) * 8 >= num_cols) {
+            bitset_of_row[row] = num_bitsets++;
+        }
+    }
+
+    if (num_bitsets == 0) {
+        bitset_of_row.clear();
+        return;
+    }
+
+    bitsets.assign(num_bitsets * words_per_row, 0);
+    for (std::size_t row = 0; row < num_rows; row++) {
+        if (bitset_of_row[row] == NO_BITSET) {
+            continue;
+        }
+        auto* words = bitsets.data() + bitset_of_row[row] * words_per_row;
+        for (auto i = offsets[row]; i < offsets[row + 1]; i++) {
+            words[cols[i] / BITS_PER_WORD] |= Word{1} << (cols[i] % BITS_PER_WORD);
+        }
+    }
+}
+
+bool IdAdjacency::contains(SymbolId row, SymbolId col) const {
+    if (row >= get_num_rows()) {
+        return false;
+    }
+
+    if (!bitset_of_row.empty() && bitset_of_row[row] != NO_BITSET) {
+        if (col / BITS_PER_WORD >= words_per_row) {
+            return false;
+        }
+        const auto word = bitsets[bitset_of_row[row] * words_per_row + col / BITS_PER_WORD];
+        return (word >> (col % BITS_PER_WORD)) & 1U;
+    }
+
+    const auto* first = cols.data() + offsets[row];
+    const auto* last = cols.data() + offsets[row + 1];
+    return std::binary_search(first, last, col);
+}
+
+bool IdAdjacency::has_row(SymbolId row) const {
+    return row < get_num_rows() && offsets[row] != offsets[row + 1];
+}
+
+IdSpan IdAdjacency::get_row(SymbolId row) const {
+    if (row >= get_num_rows()) {
+        return {};
+    }
+    return {cols.data() + offsets[row], cols.data() + offsets[row + 1]};
+}
+
+std::size_t IdAdjacency::get_num_rows() const {
+    return offsets.empty() ? 0 : offsets.size() - 1;
+}
+
+std::size_t IdAdjacency::get_num_edges() const {
+    return cols.size();
+}
+
+std::size_t IdAdjacency::get_num_dense_rows() const {
+    return bitsets.size() / std::max<std::size_t>(words_per_row, 1);
+}
@@ -94,6 +94,50 @@ bool ReadFacade::has_call_statement(const std::string& s) const {
     return pkb->has_call_statement(s);
 }
 
+bool ReadFacade::is_finalised() const {
+    return pkb->is_finalised();
+}
+
+SymbolId ReadFacade::get_statement_id(const std::string& statement_number) const {
+    return pkb->get_statement_id(statement_number);
+}
+
+std::string ReadFacade::get_statement_by_id(SymbolId id) const {
+    return pkb->get_statement_by_id(id);
+}
+
+SymbolId ReadFacade::get_variable_id(const std::string& variable) const {
+    return pkb->get_variable_id(variable);
+}
+
+std::string ReadFacade::get_variable_by_id(SymbolId id) const {
+    return pkb->get_variable_by_id(id);
+}
+
+SymbolId ReadFacade::get_procedure_id(const std::string& procedure) const {
+    return pkb->get_procedure_id(procedure);
+}
+
+std::string ReadFacade::get_procedure_by_id(SymbolId id) const {
+    return pkb->get_procedure_by_id(id);
+}
+
+SymbolId ReadFacade::get_constant_id(const std::string& constant) const {
+    return pkb->get_constant_id(constant);
+}
+
+std::string ReadFacade::get_constant_by_id(SymbolId id) const {
+    return pkb->get_constant_by_id(id);
+}
+
+bool ReadFacade::has_statement_type(SymbolId id, StatementType statement_type) const {
+    return pkb->has_statement_type(id, statement_type);
+}
+
+std::string ReadFacade::get_statement_name_attribute(const std::string& s) const {
+    return pkb->get_statement_name_attribute(s);
+}
+
 std::unordered_set<std::string> ReadFacade::get_vars_modified_by_statement(const std::string& s) const {
     return pkb->get_vars_modified_by_statement(s);
 }
@@ -356,6 +400,14 @@ std::unordered_set<std::string> ReadFacade::get_follows_stars_by(const std::stri
     return pkb->get_follows_stars_by(stmt, statement_type);
 }
 
+SetView<std::string> ReadFacade::view_follows_stars_following(const std::string& stmt) const {
+    return pkb->view_follows_stars_following(stmt);
+}
+
+SetView<std::string> ReadFacade::view_follows_stars_by(const std::string& stmt) const {
+    return pkb->view_follows_stars_by(stmt);
+}
+
 bool ReadFacade::has_parent_relation() const {
     return pkb->has_parent_relation();
 }
@@ -463,6 +515,14 @@ std::unordered_set<std::string> ReadFacade::get_parent_star_of(const std::string
     return pkb->get_parent_star_of(child, statement_type);
 }
 
+SetView<std::string> ReadFacade::view_children_star_of(const std::string& parent) const {
+    return pkb->view_children_star_of(parent);
+}
+
+SetView<std::string> ReadFacade::view_parent_star_of(const std::string& child) const {
+    return pkb->view_parent_star_of(child);
+}
+
 bool ReadFacade::has_next_relation() const {
     return pkb->has_next_relation();
 }
@@ -503,6 +563,46 @@ std::unordered_map<std::string, std::unordered_set<std::string>> ReadFacade::get
     return pkb->get_all_next_reverse();
 }
 
+SetView<std::string> ReadFacade::view_next_of(const std::string& before) const {
+    return pkb->view_next_of(before);
+}
+
+SetView<std::string> ReadFacade::view_previous_of(const std::string& after) const {
+    return pkb->view_previous_of(after);
+}
+
+bool ReadFacade::has_next_star_index() const {
+    return pkb->has_next_star_index();
+}
+
+bool ReadFacade::has_next_star_relation(const std::string& before, const std::string& after) const {
+    return pkb->has_next_star_relation(before, after);
+}
+
+std::unordered_set<std::string> ReadFacade::get_next_star_of(const std::string& before) const {
+    return pkb->get_next_star_of(before);
+}
+
+std::unordered_set<std::string> ReadFacade::get_previous_star_of(const std::string& after) const {
+    return pkb->get_previous_star_of(after);
+}
+
+bool ReadFacade::has_affects_relation(const std::string& stmt1, const std::string& stmt2) const {
+    return pkb->has_affects_relation(stmt1, stmt2);
+}
+
+SetView<std::string> ReadFacade::view_affected_by(const std::string& stmt) const {
+    return pkb->view_affected_by(stmt);
+}
+
+SetView<std::string> ReadFacade::view_affecting(const std::string& stmt) const {
+    return pkb->view_affecting(stmt);
+}
+
+const std::unordered_map<std::string, std::unordered_set<std::string>>& ReadFacade::get_all_affects() const {
+    return pkb->get_all_affects();
+}
+
 bool ReadFacade::has_calls_relation() const {
     return pkb->has_calls_relation();
 }
@@ -648,4 +748,40 @@ std::string ReadFacade::get_proc_name_by_stmt_no(const std::string& stmt_no) con
 bool ReadFacade::are_stmt_nos_in_same_proc(const std::string& stmt_no_1, const std::string& stmt_no_2) const {
     return pkb->are_stmt_nos_in_same_proc(stmt_no_1, stmt_no_2);
 }
+
+PatternMatchCache::Statistics ReadFacade::get_pattern_match_cache_statistics() const {
+    return pkb->get_pattern_match_cache_statistics();
+}
+
+void ReadFacade::set_pattern_match_cache_hook(PatternMatchCache::Hook hook) {
+    pkb->set_pattern_match_cache_hook(std::move(hook));
+}
+
+const StatisticsCatalog& ReadFacade::get_statistics() const {
+    return pkb->get_statistics();
+}
+
+std::size_t ReadFacade::get_relationship_size(RelationshipType relationship_type) const {
+    return pkb->get_relationship_size(relationship_type);
+}
+
+std::size_t ReadFacade::get_statement_count() const {
+    return pkb->get_statement_count();
+}
+
+std::size_t ReadFacade::get_statement_count(StatementType statement_type) const {
+    return pkb->get_statement_count(statement_type);
+}
+
+std::size_t ReadFacade::get_procedure_count() const {
+    return pkb->get_procedure_count();
+}
+
+std::size_t ReadFacade::get_variable_count() const {
+    return pkb->get_variable_count();
+}
+
+std::size_t ReadFacade::get_constant_count() const {
+    return pkb->get_constant_count();
+}
 } // namespace pkb
@@ -1,5 +1,6 @@
 #include "pkb/facades/write_facade.h"
 
+#include <iterator>
 #include <utility>
 
 namespace pkb {
@@ -7,74 +8,267 @@ WriteFacade::WriteFacade(std::shared_ptr<PkbManager> pkb) : pkb(std::move(pkb))
 }
 
 void WriteFacade::add_procedure(std::string procedure) {
+    if (batch != nullptr) {
+        batch->procedures.emplace_back(std::move(procedure));
+        return;
+    }
     pkb->add_procedure(std::move(procedure));
 }
 
 void WriteFacade::add_variable(std::string variable) {
+    if (batch != nullptr) {
+        batch->variables.emplace_back(std::move(variable));
+        return;
+    }
     pkb->add_variable(std::move(variable));
 }
 
 void WriteFacade::add_constant(std::string constant) {
+    if (batch != nullptr) {
+        batch->constants.emplace_back(std::move(constant));
+        return;
+    }
     pkb->add_constant(std::move(constant));
 }
 
 void WriteFacade::add_statement(const std::string& statement_number, StatementType statement_type) {
+    if (batch != nullptr) {
+        batch->statements.emplace_back(statement_number, statement_type);
+        return;
+    }
     pkb->add_statement(statement_number, statement_type);
 }
 
 void WriteFacade::add_statement_modify_var(const std::string& statement_number, std::string variable) {
+    if (batch != nullptr) {
+        batch->statement_modifies.emplace_back(statement_number, std::move(variable));
+        return;
+    }
     pkb->add_statement_modify_var(statement_number, std::move(variable));
 }
 
 void WriteFacade::add_procedure_modify_var(std::string procedure, std::string variable) {
+    if (batch != nullptr) {
+        batch->procedure_modifies.emplace_back(std::move(procedure), std::move(variable));
+        return;
+    }
     pkb->add_procedure_modify_var(std::move(procedure), std::move(variable));
 }
 
 void WriteFacade::add_statement_use_var(const std::string& statement_number, std::string variable) {
+    if (batch != nullptr) {
+        batch->statement_uses.emplace_back(statement_number, std::move(variable));
+        return;
+    }
     pkb->add_statement_use_var(statement_number, std::move(variable));
 }
 
 void WriteFacade::add_procedure_use_var(std::string procedure, std::string variable) {
+    if (batch != nullptr) {
+        batch->procedure_uses.emplace_back(std::move(procedure), std::move(variable));
+        return;
+    }
     pkb->add_procedure_use_var(std::move(procedure), std::move(variable));
 }
 
 void WriteFacade::add_follows(const std::string& stmt1, const std::string& stmt2) {
+    if (batch != nullptr) {
+        batch->follows.emplace_back(stmt1, stmt2);
+        return;
+    }
     pkb->add_follows(stmt1, stmt2);
 }
 
 void WriteFacade::add_parent(const std::string& parent, const std::string& child) {
+    if (batch != nullptr) {
+        batch->parents.emplace_back(parent, child);
+        return;
+    }
     pkb->add_parent(parent, child);
 }
 
 void WriteFacade::add_assignment(const std::string& statement_number, const std::string& lhs, const std::string& rhs) {
+    if (batch != nullptr) {
+        batch->assignments.emplace_back(statement_number, lhs, rhs);
+        return;
+    }
     pkb->add_assignment(statement_number, lhs, rhs);
 }
 
 void WriteFacade::add_if_var(const std::string& statement_number, const std::string& variable) {
+    if (batch != nullptr) {
+        batch->if_vars.emplace_back(statement_number, variable);
+        return;
+    }
     pkb->add_if_var(statement_number, variable);
 }
 
 void WriteFacade::add_while_var(const std::string& statement_number, const std::string& variable) {
+    if (batch != nullptr) {
+        batch->while_vars.emplace_back(statement_number, variable);
+        return;
+    }
     pkb->add_while_var(statement_number, variable);
 }
 
 void WriteFacade::add_next(const std::string& stmt1, const std::string& stmt2) {
+    if (batch != nullptr) {
+        batch->nexts.emplace_back(stmt1, stmt2);
+        return;
+    }
     pkb->add_next(stmt1, stmt2);
 }
 
 void WriteFacade::add_calls(const std::string& caller, const std::string& callee) {
+    if (batch != nullptr) {
+        batch->calls.emplace_back(caller, callee);
+        return;
+    }
     pkb->add_calls(caller, callee);
 }
 
 void WriteFacade::add_stmt_no_proc_called_mapping(const std::string& stmt_no, const std::string& proc_called) {
+    if (batch != nullptr) {
+        batch->stmt_no_proc_called.emplace_back(stmt_no, proc_called);
+        return;
+    }
     pkb->add_stmt_no_proc_called_mapping(stmt_no, proc_called);
 }
 
 void WriteFacade::add_proc_to_stmt_no_mapping(const std::string& procedure, const std::string& stmt_no) {
+    if (batch != nullptr) {
+        batch->proc_to_stmt_no.emplace_back(procedure, stmt_no);
+        return;
+    }
     pkb->add_proc_to_stmt_no_mapping(procedure, stmt_no);
 }
 
+// Appends a bulk write to the batch, taking over the vector when it is the first one
+static void append_pairs(WriteBatch::Pairs& batched_pairs, WriteBatch::Pairs pairs) {
+    if (batched_pairs.empty()) {
+        batched_pairs = std::move(pairs);
+        return;
+    }
+    batched_pairs.insert(batched_pairs.end(), std::make_move_iterator(pairs.begin()),
+                         std::make_move_iterator(pairs.end()));
+}
+
+void WriteFacade::add_all_statement_modify_vars(WriteBatch::Pairs statement_variable_pairs) {
+    if (batch != nullptr) {
+        append_pairs(batch->statement_modifies, std::move(statement_variable_pairs));
+        return;
+    }
+    pkb->add_all_statement_modify_vars(std::move(statement_variable_pairs));
+}
+
+void WriteFacade::add_all_procedure_modify_vars(WriteBatch::Pairs procedure_variable_pairs) {
+    if (batch != nullptr) {
+        append_pairs(batch->procedure_modifies, std::move(procedure_variable_pairs));
+        return;
+    }
+    pkb->add_all_procedure_modify_vars(std::move(procedure_variable_pairs));
+}
+
+void WriteFacade::add_all_statement_use_vars(WriteBatch::Pairs statement_variable_pairs) {
+    if (batch != nullptr) {
+        append_pairs(batch->statement_uses, std::move(statement_variable_pairs));
+        return;
+    }
+    pkb->add_all_statement_use_vars(std::move(statement_variable_pairs));
+}
+
+void WriteFacade::add_all_procedure_use_vars(WriteBatch::Pairs procedure_variable_pairs) {
+    if (batch != nullptr) {
+        append_pairs(batch->procedure_uses, std::move(procedure_variable_pairs));
+        return;
+    }
+    pkb->add_all_procedure_use_vars(std::move(procedure_variable_pairs));
+}
+
+void WriteFacade::add_all_nexts(WriteBatch::Pairs stmt_pairs) {
+    if (batch != nullptr) {
+        append_pairs(batch->nexts, std::move(stmt_pairs));
+        return;
+    }
+    pkb->add_all_nexts(std::move(stmt_pairs));
+}
+
+void WriteFacade::add_all_calls(WriteBatch::Pairs caller_callee_pairs) {
+    if (batch != nullptr) {
+        append_pairs(batch->calls, std::move(caller_callee_pairs));
+        return;
+    }
+    pkb->add_all_calls(std::move(caller_callee_pairs));
+}
+
+void WriteFacade::add_all_if_vars(WriteBatch::Pairs statement_variable_pairs) {
+    if (batch != nullptr) {
+        append_pairs(batch->if_vars, std::move(statement_variable_pairs));
+        return;
+    }
+    pkb->add_all_if_vars(std::move(statement_variable_pairs));
+}
+
+void WriteFacade::add_all_while_vars(WriteBatch::Pairs statement_variable_pairs) {
+    if (batch != nullptr) {
+        append_pairs(batch->while_vars, std::move(statement_variable_pairs));
+        return;
+    }
+    pkb->add_all_while_vars(std::move(statement_variable_pairs));
+}
+
+void WriteFacade::enable_next_star_index() {
+    pkb->enable_next_star_index();
+}
+
 void WriteFacade::finalise_pkb(const std::vector<std::string>& procedure_order) {
     pkb->finalise_pkb(procedure_order);
 }
+
+std::shared_ptr<WriteFacade> WriteFacade::create_batch() const {
+    auto batched = std::make_shared<WriteFacade>(pkb);
+    batched->batch = std::make_shared<WriteBatch>();
+    return batched;
+}
+
+void WriteFacade::commit(WriteFacade& batched) {
+    auto writes = std::move(*batched.batch);
+    *batched.batch = WriteBatch{};
+
+    for (auto& procedure : writes.procedures) {
+        add_procedure(std::move(procedure));
+    }
+    for (auto& variable : writes.variables) {
+        add_variable(std::move(variable));
+    }
+    for (auto& constant : writes.constants) {
+        add_constant(std::move(constant));
+    }
+    for (const auto& [statement_number, statement_type] : writes.statements) {
+        add_statement(statement_number, statement_type);
+    }
+    add_all_statement_modify_vars(std::move(writes.statement_modifies));
+    add_all_procedure_modify_vars(std::move(writes.procedure_modifies));
+    add_all_statement_use_vars(std::move(writes.statement_uses));
+    add_all_procedure_use_vars(std::move(writes.procedure_uses));
+    for (const auto& [stmt1, stmt2] : writes.follows) {
+        add_follows(stmt1, stmt2);
+    }
+    for (const auto& [parent, child] : writes.parents) {
+        add_parent(parent, child);
+    }
+    for (const auto& [statement_number, lhs, rhs] : writes.assignments) {
+        add_assignment(statement_number, lhs, rhs);
+    }
+    add_all_if_vars(std::move(writes.if_vars));
+    add_all_while_vars(std::move(writes.while_vars));
+    add_all_nexts(std::move(writes.nexts));
+    add_all_calls(std::move(writes.calls));
+    for (const auto& [stmt_no, proc_called] : writes.stmt_no_proc_called) {
+        add_stmt_no_proc_called_mapping(stmt_no, proc_called);
+    }
+    for (const auto& [procedure, stmt_no] : writes.proc_to_stmt_no) {
+        add_proc_to_stmt_no_mapping(procedure, stmt_no);
+    }
+}
 } // namespace pkb
\ No newline at end of file
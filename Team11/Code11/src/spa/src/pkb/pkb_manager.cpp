@@ -4,7 +4,10 @@
 #include "pkb/facades/write_facade.h"
 
 #include <algorithm>
+#include <cstdint>
+#include <numeric>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 namespace pkb {
@@ -22,7 +25,12 @@ PkbManager::PkbManager()
       direct_calls_store(std::make_shared<DirectCallsStore>()), calls_star_store(std::make_shared<CallsStarStore>()),
       if_var_store(std::make_shared<IfVarStore>()), while_var_store(std::make_shared<WhileVarStore>()),
       stmt_no_to_proc_called_store(std::make_shared<StmtNoToProcCalledStore>()),
-      proc_to_stmt_nos_store(std::make_shared<ProcToStmtNosStore>()) {
+      proc_to_stmt_nos_store(std::make_shared<ProcToStmtNosStore>()),
+      statement_symbols(std::make_shared<SymbolTable<StatementNumber>>()),
+      variable_symbols(std::make_shared<SymbolTable<Variable>>()),
+      procedure_symbols(std::make_shared<SymbolTable<Procedure>>()),
+      constant_symbols(std::make_shared<SymbolTable<Constant>>()), affects_cache(std::make_shared<AffectsCache>()),
+      pattern_match_cache(std::make_shared<PatternMatchCache>()), statistics(std::make_shared<StatisticsCatalog>()) {
 }
 
 auto PkbManager::create_facades() -> std::tuple<std::shared_ptr<ReadFacade>, std::shared_ptr<WriteFacade>> {
@@ -136,40 +144,121 @@ std::unordered_set<std::string> PkbManager::get_call_statements() const {
 }
 
 bool PkbManager::has_statement(const std::string& s) const {
+    if (finalised) {
+        auto id = statement_symbols->get_id(s);
+        return id < statement_types.size();
+    }
     auto stmts = statement_store->get_all_keys();
     return stmts.find(s) != stmts.end();
 }
 
 bool PkbManager::has_assign_statement(const std::string& s) const {
-    auto stmts = statement_store->get_keys_by_val(StatementType::Assign);
-    return stmts.find(s) != stmts.end();
+    return has_statement_type(s, StatementType::Assign);
 }
 
 bool PkbManager::has_if_statement(const std::string& s) const {
-    auto stmts = statement_store->get_keys_by_val(StatementType::If);
-    return stmts.find(s) != stmts.end();
+    return has_statement_type(s, StatementType::If);
 }
 
 bool PkbManager::has_while_statement(const std::string& s) const {
-    auto stmts = statement_store->get_keys_by_val(StatementType::While);
-    return stmts.find(s) != stmts.end();
+    return has_statement_type(s, StatementType::While);
 }
 
 bool PkbManager::has_read_statement(const std::string& s) const {
-    auto stmts = statement_store->get_keys_by_val(StatementType::Read);
-    return stmts.find(s) != stmts.end();
+    return has_statement_type(s, StatementType::Read);
 }
 
 bool PkbManager::has_print_statement(const std::string& s) const {
-    auto stmts = statement_store->get_keys_by_val(StatementType::Print);
-    return stmts.find(s) != stmts.end();
+    return has_statement_type(s, StatementType::Print);
 }
 
 bool PkbManager::has_call_statement(const std::string& s) const {
-    auto stmts = statement_store->get_keys_by_val(StatementType::Call);
+    return has_statement_type(s, StatementType::Call);
+}
+
+bool PkbManager::is_finalised() const {
+    return finalised;
+}
+
+SymbolId PkbManager::get_statement_id(const std::string& statement_number) const {
+    return finalised ? statement_symbols->get_id(statement_number) : INVALID_SYMBOL_ID;
+}
+
+std::string PkbManager::get_statement_by_id(SymbolId id) const {
+    return statement_symbols->get_symbol(id);
+}
+
+SymbolId PkbManager::get_variable_id(const std::string& variable) const {
+    return finalised ? variable_symbols->get_id(Variable(variable)) : INVALID_SYMBOL_ID;
+}
+
+std::string PkbManager::get_variable_by_id(SymbolId id) const {
+    return variable_symbols->get_symbol(id).get_name();
+}
+
+SymbolId PkbManager::get_procedure_id(const std::string& procedure) const {
+    return finalised ? procedure_symbols->get_id(Procedure(procedure)) : INVALID_SYMBOL_ID;
+}
+
+std::string PkbManager::get_procedure_by_id(SymbolId id) const {
+    return procedure_symbols->get_symbol(id).get_name();
+}
+
+SymbolId PkbManager::get_constant_id(const std::string& constant) const {
+    return finalised ? constant_symbols->get_id(Constant(constant)) : INVALID_SYMBOL_ID;
+}
+
+std::string PkbManager::get_constant_by_id(SymbolId id) const {
+    return constant_symbols->get_symbol(id).get_name();
+}
+
+bool PkbManager::has_statement_type(SymbolId id, StatementType statement_type) const {
+    return id < statement_types.size() && statement_types[id] == statement_type;
+}
+
+StatementType PkbManager::get_statement_type(const std::string& s) const {
+    if (finalised) {
+        auto id = statement_symbols->get_id(s);
+        if (id < statement_types.size()) {
+            return statement_types[id];
+        }
+    }
+    return statement_store->get_val_by_key(s);
+}
+
+bool PkbManager::has_statement_type(const std::string& s, StatementType statement_type) const {
+    if (finalised) {
+        return has_statement_type(statement_symbols->get_id(s), statement_type);
+    }
+    auto stmts = statement_store->get_keys_by_val(statement_type);
     return stmts.find(s) != stmts.end();
 }
 
+std::string PkbManager::get_statement_name_attribute(const std::string& s) const {
+    if (finalised) {
+        auto id = statement_symbols->get_id(s);
+        return id < statement_name_attributes.size() ? statement_name_attributes[id] : std::string{};
+    }
+    return has_statement(s) ? compute_statement_name_attribute(s, get_statement_type(s)) : std::string{};
+}
+
+std::string PkbManager::compute_statement_name_attribute(const std::string& s, StatementType statement_type) const {
+    switch (statement_type) {
+    case StatementType::Read: {
+        auto variables = statement_modifies_store->get_vals_by_key(s);
+        return variables.empty() ? std::string{} : variables.begin()->get_name();
+    }
+    case StatementType::Print: {
+        auto variables = statement_uses_store->get_vals_by_key(s);
+        return variables.empty() ? std::string{} : variables.begin()->get_name();
+    }
+    case StatementType::Call:
+        return stmt_no_to_proc_called_store->get_val_by_key(s).get_name();
+    default:
+        return {};
+    }
+}
+
 std::unordered_set<std::string> PkbManager::get_vars_modified_by_statement(const std::string& s) const {
     auto variables = statement_modifies_store->get_vals_by_key(s);
     return get_name_list(variables);
@@ -407,7 +496,7 @@ std::string PkbManager::get_statement_following(const std::string& s) const {
 std::string PkbManager::get_statement_following(const std::string& s, const StatementType& statement_type) const {
     auto stmt = direct_follows_store->get_val_by_key(s);
 
-    if (statement_store->get_val_by_key(stmt) == statement_type) {
+    if (get_statement_type(stmt) == statement_type) {
         return stmt;
     }
 
@@ -421,7 +510,7 @@ std::string PkbManager::get_statement_followed_by(const std::string& s) const {
 std::string PkbManager::get_statement_followed_by(const std::string& s, const StatementType& statement_type) const {
     auto stmt = direct_follows_store->get_key_by_val(s);
 
-    if (statement_store->get_val_by_key(stmt) == statement_type) {
+    if (get_statement_type(stmt) == statement_type) {
         return stmt;
     }
 
@@ -486,6 +575,14 @@ std::unordered_set<std::string> PkbManager::get_follows_stars_by(const std::stri
     return filter_by_statement_type(stmts_pool, statement_type);
 }
 
+SetView<std::string> PkbManager::view_follows_stars_following(const std::string& stmt) const {
+    return follows_star_store->view_vals_by_key(stmt);
+}
+
+SetView<std::string> PkbManager::view_follows_stars_by(const std::string& stmt) const {
+    return follows_star_store->view_keys_by_val(stmt);
+}
+
 bool PkbManager::has_parent_relation() const {
     return direct_parent_store->has_relationship();
 }
@@ -541,7 +638,7 @@ std::string PkbManager::get_parent_of(const std::string& child) const {
 std::string PkbManager::get_parent_of(const std::string& child, const StatementType& statement_type) const {
     auto stmt = get_parent_of(child);
 
-    if (statement_store->get_val_by_key(stmt) == statement_type) {
+    if (get_statement_type(stmt) == statement_type) {
         return stmt;
     }
 
@@ -606,6 +703,14 @@ std::unordered_set<std::string> PkbManager::get_parent_star_of(const std::string
     return filter_by_statement_type(stmts_pool, statement_type);
 }
 
+SetView<std::string> PkbManager::view_children_star_of(const std::string& parent) const {
+    return parent_star_store->view_vals_by_key(parent);
+}
+
+SetView<std::string> PkbManager::view_parent_star_of(const std::string& child) const {
+    return parent_star_store->view_keys_by_val(child);
+}
+
 bool PkbManager::has_next_relation() const {
     return next_store->has_relationship();
 }
@@ -646,6 +751,277 @@ std::unordered_map<std::string, std::unordered_set<std::string>> PkbManager::get
     return next_store->get_all_reverse();
 }
 
+SetView<std::string> PkbManager::view_next_of(const std::string& before) const {
+    return next_store->view_vals_by_key(before);
+}
+
+SetView<std::string> PkbManager::view_previous_of(const std::string& after) const {
+    return next_store->view_keys_by_val(after);
+}
+
+bool PkbManager::has_next_star_index() const {
+    return finalised && next_star_index != nullptr && next_store->is_frozen();
+}
+
+bool PkbManager::has_next_star_relation(const std::string& before, const std::string& after) const {
+    return next_star_index->contains(statement_symbols->get_id(before), statement_symbols->get_id(after));
+}
+
+std::unordered_set<std::string> PkbManager::get_next_star_of(const std::string& before) const {
+    return to_statements(next_star_index->get_reachable_from(statement_symbols->get_id(before)));
+}
+
+std::unordered_set<std::string> PkbManager::get_previous_star_of(const std::string& after) const {
+    return to_statements(next_star_index->get_reaching(statement_symbols->get_id(after)));
+}
+
+std::unordered_set<std::string> PkbManager::to_statements(const std::vector<SymbolId>& ids) const {
+    std::unordered_set<std::string> statements;
+    statements.reserve(ids.size());
+    for (auto id : ids) {
+        statements.insert(statement_symbols->get_symbol(id));
+    }
+    return statements;
+}
+
+bool PkbManager::has_affects_relation(const std::string& stmt1, const std::string& stmt2) const {
+    const auto& affected = affects_cache->get_affected_by(stmt1, [this](const std::string& stmt) {
+        return compute_affected_by(stmt);
+    });
+    return affected.find(stmt2) != affected.end();
+}
+
+SetView<std::string> PkbManager::view_affected_by(const std::string& stmt) const {
+    return SetView<std::string>{&affects_cache->get_affected_by(stmt, [this](const std::string& s) {
+        return compute_affected_by(s);
+    })};
+}
+
+SetView<std::string> PkbManager::view_affecting(const std::string& stmt) const {
+    return SetView<std::string>{&affects_cache->get_affecting(stmt, [this](const std::string& s) {
+        return compute_affecting(s);
+    })};
+}
+
+const std::unordered_map<std::string, std::unordered_set<std::string>>& PkbManager::get_all_affects() const {
+    return affects_cache->get_all_affects([this]() {
+        return compute_all_affects();
+    });
+}
+
+// Whether a statement on a control flow path overwrites the variable; containers only modify through their bodies
+bool PkbManager::kills_var(const std::string& s, const std::string& variable) const {
+    return contains_statement_modify_var(s, variable) && !has_statement_type(s, StatementType::If) &&
+           !has_statement_type(s, StatementType::While);
+}
+
+std::unordered_set<std::string> PkbManager::compute_affected_by(const std::string& stmt) const {
+    if (!has_statement_type(stmt, StatementType::Assign)) {
+        return {};
+    }
+
+    const auto modified_vars = get_vars_modified_by_statement(stmt);
+    if (modified_vars.size() != 1) {
+        return {};
+    }
+    const auto& variable = *modified_vars.begin();
+
+    // Walk forward until the variable is overwritten; Next never leaves the procedure
+    std::unordered_set<std::string> affected;
+    std::unordered_set<std::string> visited;
+    const auto successors = view_next_of(stmt);
+    std::vector<std::string> stack(successors.begin(), successors.end());
+    while (!stack.empty()) {
+        auto current = std::move(stack.back());
+        stack.pop_back();
+        if (!visited.insert(current).second) {
+            continue;
+        }
+
+        if (has_statement_type(current, StatementType::Assign) && contains_statement_use_var(current, variable)) {
+            affected.insert(current);
+        }
+        if (kills_var(current, variable)) {
+            continue;
+        }
+        for (const auto& next : view_next_of(current)) {
+            stack.push_back(next);
+        }
+    }
+
+    return affected;
+}
+
+std::unordered_set<std::string> PkbManager::compute_affecting(const std::string& stmt) const {
+    if (!has_statement_type(stmt, StatementType::Assign)) {
+        return {};
+    }
+
+    // Walk backward per used variable; the first statement overwriting it on each path is the only candidate
+    std::unordered_set<std::string> affecting;
+    for (const auto& variable : get_vars_used_by_statement(stmt)) {
+        std::unordered_set<std::string> visited;
+        const auto predecessors = view_previous_of(stmt);
+        std::vector<std::string> stack(predecessors.begin(), predecessors.end());
+        while (!stack.empty()) {
+            auto current = std::move(stack.back());
+            stack.pop_back();
+            if (!visited.insert(current).second) {
+                continue;
+            }
+
+            if (kills_var(current, variable)) {
+                if (has_statement_type(current, StatementType::Assign)) {
+                    affecting.insert(current);
+                }
+                continue;
+            }
+            for (const auto& previous : view_previous_of(current)) {
+                stack.push_back(previous);
+            }
+        }
+    }
+
+    return affecting;
+}
+
+std::unordered_map<std::string, std::unordered_set<std::string>> PkbManager::compute_all_affects() const {
+    // Next never crosses procedures, so each procedure is solved on its own; unmapped statements share one group
+    std::unordered_map<std::string, std::vector<std::string>> stmts_by_proc;
+    for (const auto& stmt : get_all_statements()) {
+        stmts_by_proc[get_proc_name_by_stmt_no(stmt)].push_back(stmt);
+    }
+
+    std::unordered_map<std::string, std::unordered_set<std::string>> affects;
+    for (auto& [_, stmts] : stmts_by_proc) {
+        // Numeric order, so the first sweep mostly follows control flow
+        std::sort(stmts.begin(), stmts.end(), [](const std::string& lhs, const std::string& rhs) {
+            return std::make_tuple(lhs.size(), lhs) < std::make_tuple(rhs.size(), rhs);
+        });
+        compute_procedure_affects(stmts, affects);
+    }
+    return affects;
+}
+
+/**
+ * Reaching definitions over the statements of one procedure. Every assignment is a definition; a statement kills
+ * the definitions of each variable it overwrites. An assignment is affected by the reaching definitions of the
+ * variables it uses.
+ */
+void PkbManager::compute_procedure_affects(
+    const std::vector<std::string>& stmts,
+    std::unordered_map<std::string, std::unordered_set<std::string>>& affects) const {
+    using Word = std::uint64_t;
+    static constexpr std::size_t BITS_PER_WORD = 64;
+
+    std::unordered_map<std::string, std::size_t> node_of;
+    std::vector<std::size_t> assign_nodes;
+    std::vector<std::size_t> def_of_node(stmts.size(), stmts.size());
+    std::vector<std::string> var_of_def;
+    std::vector<std::size_t> node_of_def;
+    for (std::size_t node = 0; node < stmts.size(); node++) {
+        node_of[stmts[node]] = node;
+        if (!has_statement_type(stmts[node], StatementType::Assign)) {
+            continue;
+        }
+        assign_nodes.push_back(node);
+        const auto modified_vars = get_vars_modified_by_statement(stmts[node]);
+        if (modified_vars.size() == 1) {
+            def_of_node[node] = var_of_def.size();
+            var_of_def.push_back(*modified_vars.begin());
+            node_of_def.push_back(node);
+        }
+    }
+    if (var_of_def.empty()) {
+        return;
+    }
+
+    const auto words = (var_of_def.size() + BITS_PER_WORD - 1) / BITS_PER_WORD;
+    std::unordered_map<std::string, std::vector<Word>> defs_of_var;
+    for (std::size_t def = 0; def < var_of_def.size(); def++) {
+        auto& defs = defs_of_var.try_emplace(var_of_def[def], words, 0).first->second;
+        defs[def / BITS_PER_WORD] |= Word{1} << (def % BITS_PER_WORD);
+    }
+
+    // Containers modify only through their bodies, so only simple statements kill
+    std::vector<Word> kill(stmts.size() * words, 0);
+    for (std::size_t node = 0; node < stmts.size(); node++) {
+        if (has_statement_type(stmts[node], StatementType::If) ||
+            has_statement_type(stmts[node], StatementType::While)) {
+            continue;
+        }
+        for (const auto& var : get_vars_modified_by_statement(stmts[node])) {
+            const auto it = defs_of_var.find(var);
+            if (it == defs_of_var.end()) {
+                continue;
+            }
+            for (std::size_t word = 0; word < words; word++) {
+                kill[node * words + word] |= it->second[word];
+            }
+        }
+    }
+
+    // Iterate to a fixpoint with a worklist, starting in statement order
+    std::vector<Word> in(stmts.size() * words, 0);
+    std::vector<Word> out(stmts.size() * words, 0);
+    std::vector<std::size_t> worklist(stmts.size());
+    std::iota(worklist.rbegin(), worklist.rend(), 0);
+    std::vector<bool> queued(stmts.size(), true);
+    while (!worklist.empty()) {
+        const auto node = worklist.back();
+        worklist.pop_back();
+        queued[node] = false;
+
+        for (const auto& previous : view_previous_of(stmts[node])) {
+            const auto it = node_of.find(previous);
+            if (it == node_of.end()) {
+                continue;
+            }
+            for (std::size_t word = 0; word < words; word++) {
+                in[node * words + word] |= out[it->second * words + word];
+            }
+        }
+
+        auto changed = false;
+        for (std::size_t word = 0; word < words; word++) {
+            auto new_out = in[node * words + word] & ~kill[node * words + word];
+            if (def_of_node[node] < var_of_def.size() && def_of_node[node] / BITS_PER_WORD == word) {
+                new_out |= Word{1} << (def_of_node[node] % BITS_PER_WORD);
+            }
+            if (new_out != out[node * words + word]) {
+                out[node * words + word] = new_out;
+                changed = true;
+            }
+        }
+        if (!changed) {
+            continue;
+        }
+        for (const auto& next : view_next_of(stmts[node])) {
+            const auto it = node_of.find(next);
+            if (it != node_of.end() && !queued[it->second]) {
+                queued[it->second] = true;
+                worklist.push_back(it->second);
+            }
+        }
+    }
+
+    for (std::size_t def = 0; def < var_of_def.size(); def++) {
+        affects.try_emplace(stmts[node_of_def[def]]);
+    }
+    for (const auto use_node : assign_nodes) {
+        const auto used_vars = get_vars_used_by_statement(stmts[use_node]);
+        for (std::size_t word = 0; word < words; word++) {
+            const auto reaching = in[use_node * words + word];
+            for (std::size_t bit = 0; bit < BITS_PER_WORD && (reaching >> bit) != 0; bit++) {
+                const auto def = word * BITS_PER_WORD + bit;
+                if (((reaching >> bit) & 1U) != 0 && used_vars.find(var_of_def[def]) != used_vars.end()) {
+                    affects[stmts[node_of_def[def]]].insert(stmts[use_node]);
+                }
+            }
+        }
+    }
+}
+
 bool PkbManager::has_calls_relation() const {
     return direct_calls_store->has_relationship();
 }
@@ -724,11 +1100,15 @@ std::unordered_set<std::string> PkbManager::get_star_callers(const std::string&
 }
 
 std::unordered_set<std::string> PkbManager::get_all_assignments_rhs(const std::string& rhs) const {
-    return assignment_store->get_all_assignments_rhs(rhs);
+    return pattern_match_cache->get_matches("", rhs, false, [this, &rhs]() {
+        return assignment_store->get_all_assignments_rhs(rhs);
+    });
 }
 
 std::unordered_set<std::string> PkbManager::get_all_assignments_rhs_partial(const std::string& rhs) const {
-    return assignment_store->get_all_assignments_rhs_partial(rhs);
+    return pattern_match_cache->get_matches("", rhs, true, [this, &rhs]() {
+        return assignment_store->get_all_assignments_rhs_partial(rhs);
+    });
 }
 
 std::unordered_set<std::string> PkbManager::get_all_assignments_lhs(const std::string& lhs) const {
@@ -738,14 +1118,18 @@ std::unordered_set<std::string> PkbManager::get_all_assignments_lhs(const std::s
 
 std::unordered_set<std::string> PkbManager::get_all_assignments_lhs_rhs(const std::string& lhs,
                                                                         const std::string& rhs) const {
-    auto v = Variable(lhs);
-    return assignment_store->get_all_assignments_lhs_rhs(v, rhs);
+    return pattern_match_cache->get_matches(lhs, rhs, false, [this, &lhs, &rhs]() {
+        auto v = Variable(lhs);
+        return assignment_store->get_all_assignments_lhs_rhs(v, rhs);
+    });
 }
 
 std::unordered_set<std::string> PkbManager::get_all_assignments_lhs_rhs_partial(const std::string& lhs,
                                                                                 const std::string& rhs) const {
-    auto v = Variable(lhs);
-    return assignment_store->get_all_assignments_lhs_rhs_partial(v, rhs);
+    return pattern_match_cache->get_matches(lhs, rhs, true, [this, &lhs, &rhs]() {
+        auto v = Variable(lhs);
+        return assignment_store->get_all_assignments_lhs_rhs_partial(v, rhs);
+    });
 }
 
 std::unordered_set<std::string> PkbManager::get_if_stmts_with_var() const {
@@ -824,28 +1208,104 @@ bool PkbManager::are_stmt_nos_in_same_proc(const std::string& stmt_no_1, const s
     return p1 == p2;
 }
 
+PatternMatchCache::Statistics PkbManager::get_pattern_match_cache_statistics() const {
+    return pattern_match_cache->get_statistics();
+}
+
+void PkbManager::set_pattern_match_cache_hook(PatternMatchCache::Hook hook) {
+    pattern_match_cache->set_hook(std::move(hook));
+}
+
+const StatisticsCatalog& PkbManager::get_statistics() const {
+    return *statistics;
+}
+
+std::size_t PkbManager::get_relationship_size(RelationshipType relationship_type) const {
+    if (finalised) {
+        return statistics->get_relation_statistics(relationship_type).size;
+    }
+
+    switch (relationship_type) {
+    case RelationshipType::Follows:
+        return direct_follows_store->size();
+    case RelationshipType::FollowsStar:
+        return follows_star_store->size();
+    case RelationshipType::Parent:
+        return direct_parent_store->size();
+    case RelationshipType::ParentStar:
+        return parent_star_store->size();
+    case RelationshipType::UsesS:
+        return statement_uses_store->size();
+    case RelationshipType::UsesP:
+        return procedure_uses_store->size();
+    case RelationshipType::ModifiesS:
+        return statement_modifies_store->size();
+    case RelationshipType::ModifiesP:
+        return procedure_modifies_store->size();
+    case RelationshipType::Next:
+        return next_store->size();
+    case RelationshipType::Calls:
+        return direct_calls_store->size();
+    case RelationshipType::CallsStar:
+        return calls_star_store->size();
+    }
+    return 0;
+}
+
+std::size_t PkbManager::get_statement_count() const {
+    if (finalised) {
+        return statistics->get_statement_count();
+    }
+    return statement_store->get_all_keys().size();
+}
+
+std::size_t PkbManager::get_statement_count(StatementType statement_type) const {
+    if (finalised) {
+        return statistics->get_statement_count(statement_type);
+    }
+    return statement_store->get_keys_by_val(statement_type).size();
+}
+
+std::size_t PkbManager::get_procedure_count() const {
+    return entity_store->get_procedure_count();
+}
+
+std::size_t PkbManager::get_variable_count() const {
+    return entity_store->get_variable_count();
+}
+
+std::size_t PkbManager::get_constant_count() const {
+    return entity_store->get_constant_count();
+}
+
 // WriteFacade APIs
 void PkbManager::add_procedure(std::string procedure) {
+    finalised = false;
     Procedure p = Procedure(std::move(procedure));
     entity_store->add_procedure(p);
 }
 
 void PkbManager::add_variable(std::string variable) {
+    finalised = false;
     Variable v = Variable(std::move(variable));
     entity_store->add_variable(v);
 }
 
 void PkbManager::add_constant(std::string constant) {
+    finalised = false;
     Constant c = Constant(std::move(constant));
     entity_store->add_constant(c);
 }
 
 void PkbManager::add_statement(const std::string& statement_number, StatementType statement_type) {
+    finalised = false;
+    affects_cache->clear();
     statement_store->add(statement_number, statement_type);
 }
 
 void PkbManager::add_statement_modify_var(const std::string& statement_number, std::string variable) {
     auto v = Variable(std::move(variable));
+    affects_cache->clear();
     statement_modifies_store->add(statement_number, v);
 }
 
@@ -857,6 +1317,7 @@ void PkbManager::add_procedure_modify_var(std::string procedure, std::string var
 
 void PkbManager::add_statement_use_var(const std::string& statement_number, std::string variable) {
     auto v = Variable(std::move(variable));
+    affects_cache->clear();
     statement_uses_store->add(statement_number, v);
 }
 
@@ -876,6 +1337,7 @@ void PkbManager::add_parent(const std::string& parent, const std::string& child)
 
 void PkbManager::add_assignment(const std::string& statement_number, const std::string& lhs, const std::string& rhs) {
     auto v = Variable(lhs);
+    pattern_match_cache->clear();
     assignment_store->add_assignment(statement_number, v, rhs);
 }
 
@@ -890,6 +1352,7 @@ void PkbManager::add_while_var(const std::string& statement_number, const std::s
 }
 
 void PkbManager::add_next(const std::string& stmt1, const std::string& stmt2) {
+    affects_cache->clear();
     next_store->add(stmt1, stmt2);
 }
 
@@ -950,6 +1413,65 @@ void PkbManager::add_proc_to_stmt_no_mapping(const std::string& procedure, const
     proc_to_stmt_nos_store->add(p, stmt_no);
 }
 
+// Converts (key, value) string pairs into the types of a many-to-many store and loads them in one go
+template <class Store>
+static void add_all_pairs(Store& store, PkbManager::Pairs pairs) {
+    std::vector<std::pair<typename Store::Key, typename Store::Value>> typed_pairs;
+    typed_pairs.reserve(pairs.size());
+    for (auto& [key, value] : pairs) {
+        typed_pairs.emplace_back(typename Store::Key(std::move(key)), typename Store::Value(std::move(value)));
+    }
+    store.add_all(std::move(typed_pairs));
+}
+
+// The pattern stores are keyed by variable, so (statement, variable) pairs are flipped before loading
+static void swap_pairs(PkbManager::Pairs& pairs) {
+    for (auto& [first, second] : pairs) {
+        std::swap(first, second);
+    }
+}
+
+void PkbManager::add_all_statement_modify_vars(Pairs statement_variable_pairs) {
+    affects_cache->clear();
+    add_all_pairs(*statement_modifies_store, std::move(statement_variable_pairs));
+}
+
+void PkbManager::add_all_procedure_modify_vars(Pairs procedure_variable_pairs) {
+    add_all_pairs(*procedure_modifies_store, std::move(procedure_variable_pairs));
+}
+
+void PkbManager::add_all_statement_use_vars(Pairs statement_variable_pairs) {
+    affects_cache->clear();
+    add_all_pairs(*statement_uses_store, std::move(statement_variable_pairs));
+}
+
+void PkbManager::add_all_procedure_use_vars(Pairs procedure_variable_pairs) {
+    add_all_pairs(*procedure_uses_store, std::move(procedure_variable_pairs));
+}
+
+void PkbManager::add_all_nexts(Pairs stmt_pairs) {
+    affects_cache->clear();
+    add_all_pairs(*next_store, std::move(stmt_pairs));
+}
+
+void PkbManager::add_all_calls(Pairs caller_callee_pairs) {
+    add_all_pairs(*direct_calls_store, std::move(caller_callee_pairs));
+}
+
+void PkbManager::add_all_if_vars(Pairs statement_variable_pairs) {
+    swap_pairs(statement_variable_pairs);
+    add_all_pairs(*if_var_store, std::move(statement_variable_pairs));
+}
+
+void PkbManager::add_all_while_vars(Pairs statement_variable_pairs) {
+    swap_pairs(statement_variable_pairs);
+    add_all_pairs(*while_var_store, std::move(statement_variable_pairs));
+}
+
+void PkbManager::enable_next_star_index() {
+    next_star_index_enabled = true;
+}
+
 void PkbManager::finalise_pkb(const std::vector<std::string>& procedure_string_order) {
     std::vector<Procedure> procedure_order;
     std::transform(procedure_string_order.begin(), procedure_string_order.end(), std::back_inserter(procedure_order),
@@ -957,8 +1479,180 @@ void PkbManager::finalise_pkb(const std::vector<std::string>& procedure_string_o
                        return Procedure(s);
                    });
 
+    thaw_stores();
+
     populate_star_from_direct(direct_follows_store, follows_star_store, OrderingBySecondElement{});
     populate_star_from_direct(direct_parent_store, parent_star_store, OrderingBySecondElement{});
     populate_star_from_direct(direct_calls_store, calls_star_store, OrderingByIndexMap{procedure_order});
+
+    build_symbol_tables();
+    freeze_stores();
+    if (next_star_index_enabled) {
+        next_star_index = std::make_shared<NextStarIndex>(statement_symbols->size(), *next_store);
+    }
+    build_statistics();
+    finalised = true;
+}
+
+template <class T, class Compare>
+static void intern_sorted(SymbolTable<T>& table, std::unordered_set<T> symbols, Compare compare) {
+    std::vector<T> sorted(std::make_move_iterator(symbols.begin()), std::make_move_iterator(symbols.end()));
+    std::sort(sorted.begin(), sorted.end(), compare);
+    for (const auto& symbol : sorted) {
+        table.intern(symbol);
+    }
+}
+
+void PkbManager::build_symbol_tables() {
+    statement_symbols->clear();
+    variable_symbols->clear();
+    procedure_symbols->clear();
+    constant_symbols->clear();
+
+    // Statements are numbered in program order so that id order matches numeric order
+    intern_sorted(*statement_symbols, statement_store->get_all_keys(), [](const auto& lhs, const auto& rhs) {
+        return lhs.size() != rhs.size() ? lhs.size() < rhs.size() : lhs < rhs;
+    });
+    const auto by_name = [](const auto& lhs, const auto& rhs) {
+        return lhs.get_name() < rhs.get_name();
+    };
+    intern_sorted(*variable_symbols, entity_store->get_variables(), by_name);
+    intern_sorted(*procedure_symbols, entity_store->get_procedures(), by_name);
+    intern_sorted(*constant_symbols, entity_store->get_constants(), by_name);
+
+    statement_types.clear();
+    statement_types.reserve(statement_symbols->size());
+    statement_name_attributes.clear();
+    statement_name_attributes.reserve(statement_symbols->size());
+    for (const auto& statement : statement_symbols->get_symbols()) {
+        statement_types.push_back(statement_store->get_val_by_key(statement));
+        statement_name_attributes.push_back(compute_statement_name_attribute(statement, statement_types.back()));
+    }
+}
+
+void PkbManager::freeze_stores() {
+    follows_star_store->freeze(statement_symbols, statement_symbols, true);
+    parent_star_store->freeze(statement_symbols, statement_symbols, true);
+    next_store->freeze(statement_symbols, statement_symbols, true);
+    statement_modifies_store->freeze(statement_symbols, variable_symbols);
+    statement_uses_store->freeze(statement_symbols, variable_symbols);
+    procedure_modifies_store->freeze(procedure_symbols, variable_symbols);
+    procedure_uses_store->freeze(procedure_symbols, variable_symbols);
+    direct_calls_store->freeze(procedure_symbols, procedure_symbols);
+    calls_star_store->freeze(procedure_symbols, procedure_symbols, true);
+    if_var_store->freeze(variable_symbols, statement_symbols);
+    while_var_store->freeze(variable_symbols, statement_symbols);
+}
+
+// Scans a frozen store row by row over the ids; the type vectors are null for sides that are not statements
+template <class Store>
+static RelationStatistics collect_frozen_statistics(const Store& store, std::size_t num_keys, std::size_t num_values,
+                                                    const std::vector<StatementType>* key_types,
+                                                    const std::vector<StatementType>* value_types) {
+    RelationStatistics statistics;
+    for (SymbolId key = 0; key < num_keys; key++) {
+        const auto values = store.get_vals_by_key(key);
+        if (values.empty()) {
+            continue;
+        }
+        statistics.size += values.size();
+        statistics.distinct_keys++;
+        if (key_types != nullptr && key < key_types->size()) {
+            statistics.key_histogram[static_cast<std::size_t>((*key_types)[key])] += values.size();
+        }
+    }
+
+    for (SymbolId value = 0; value < num_values; value++) {
+        const auto keys = store.get_keys_by_val(value);
+        if (keys.empty()) {
+            continue;
+        }
+        statistics.distinct_values++;
+        if (value_types != nullptr && value < value_types->size()) {
+            statistics.value_histogram[static_cast<std::size_t>((*value_types)[value])] += keys.size();
+        }
+    }
+    return statistics;
+}
+
+// Scans a store of direct statement pairs, which are few enough to be copied out
+template <class Store, class TypeOf>
+static RelationStatistics collect_statement_pair_statistics(const Store& store, TypeOf type_of) {
+    RelationStatistics statistics;
+    std::unordered_set<StatementNumber> keys;
+    std::unordered_set<StatementNumber> values;
+    for (const auto& [key, value] : store.get_all_pairs()) {
+        statistics.size++;
+        keys.insert(key);
+        values.insert(value);
+        statistics.key_histogram[static_cast<std::size_t>(type_of(key))]++;
+        statistics.value_histogram[static_cast<std::size_t>(type_of(value))]++;
+    }
+    statistics.distinct_keys = keys.size();
+    statistics.distinct_values = values.size();
+    return statistics;
+}
+
+void PkbManager::build_statistics() {
+    statistics = std::make_shared<StatisticsCatalog>();
+    statistics->set_statement_types(statement_types);
+    statistics->set_entity_counts(entity_store->get_procedure_count(), entity_store->get_variable_count(),
+                                  entity_store->get_constant_count());
+
+    const auto type_of = [this](const std::string& statement) {
+        return statement_store->get_val_by_key(statement);
+    };
+    statistics->set_relation_statistics(RelationshipType::Follows,
+                                        collect_statement_pair_statistics(*direct_follows_store, type_of));
+    statistics->set_relation_statistics(RelationshipType::Parent,
+                                        collect_statement_pair_statistics(*direct_parent_store, type_of));
+
+    const auto num_statements = statement_symbols->size();
+    const auto num_variables = variable_symbols->size();
+    const auto num_procedures = procedure_symbols->size();
+    const auto* types = &statement_types;
+    statistics->set_relation_statistics(
+        RelationshipType::FollowsStar,
+        collect_frozen_statistics(*follows_star_store, num_statements, num_statements, types, types));
+    statistics->set_relation_statistics(
+        RelationshipType::ParentStar,
+        collect_frozen_statistics(*parent_star_store, num_statements, num_statements, types, types));
+    statistics->set_relation_statistics(
+        RelationshipType::Next, collect_frozen_statistics(*next_store, num_statements, num_statements, types, types));
+    statistics->set_relation_statistics(
+        RelationshipType::ModifiesS,
+        collect_frozen_statistics(*statement_modifies_store, num_statements, num_variables, types, nullptr));
+    statistics->set_relation_statistics(
+        RelationshipType::UsesS,
+        collect_frozen_statistics(*statement_uses_store, num_statements, num_variables, types, nullptr));
+    statistics->set_relation_statistics(
+        RelationshipType::ModifiesP,
+        collect_frozen_statistics(*procedure_modifies_store, num_procedures, num_variables, nullptr, nullptr));
+    statistics->set_relation_statistics(
+        RelationshipType::UsesP,
+        collect_frozen_statistics(*procedure_uses_store, num_procedures, num_variables, nullptr, nullptr));
+    statistics->set_relation_statistics(
+        RelationshipType::Calls,
+        collect_frozen_statistics(*direct_calls_store, num_procedures, num_procedures, nullptr, nullptr));
+    statistics->set_relation_statistics(
+        RelationshipType::CallsStar,
+        collect_frozen_statistics(*calls_star_store, num_procedures, num_procedures, nullptr, nullptr));
+}
+
+void PkbManager::thaw_stores() {
+    next_star_index = nullptr;
+    affects_cache->clear();
+    pattern_match_cache->clear();
+    follows_star_store->thaw();
+    parent_star_store->thaw();
+    next_store->thaw();
+    statement_modifies_store->thaw();
+    statement_uses_store->thaw();
+    procedure_modifies_store->thaw();
+    procedure_uses_store->thaw();
+    direct_calls_store->thaw();
+    calls_star_store->thaw();
+    if_var_store->thaw();
+    while_var_store->thaw();
 }
 } // namespace pkb
\ No newline at end of file
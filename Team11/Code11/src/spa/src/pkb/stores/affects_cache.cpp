@@ -0,0 +1,67 @@
+#include "pkb/stores/affects_cache.h"
+
+AffectsCache::AffectsCache() = default;
+
+const AffectsCache::StatementSet& AffectsCache::get_affected_by(const std::string& statement,
+                                                               const Compute& compute) {
+    return get_or_compute(affected_by, statement, compute);
+}
+
+const AffectsCache::StatementSet& AffectsCache::get_affecting(const std::string& statement, const Compute& compute) {
+    return get_or_compute(affecting, statement, compute);
+}
+
+const AffectsCache::AffectsMap& AffectsCache::get_all_affects(const ComputeAll& compute_all) {
+    const auto lock = std::lock_guard{mutex};
+    if (is_complete) {
+        return affected_by;
+    }
+
+    // Sets memoised earlier are already complete and may be referenced elsewhere, so only missing ones are added
+    AffectsMap all_affecting;
+    for (auto& [statement, affected] : compute_all()) {
+        for (const auto& other : affected) {
+            all_affecting[other].insert(statement);
+        }
+        affected_by.try_emplace(statement, std::move(affected));
+    }
+    for (auto& [statement, affecting_statements] : all_affecting) {
+        affecting.try_emplace(statement, std::move(affecting_statements));
+    }
+    is_complete = true;
+    return affected_by;
+}
+
+void AffectsCache::clear() {
+    const auto lock = std::lock_guard{mutex};
+    affected_by.clear();
+    affecting.clear();
+    is_complete = false;
+}
+
+const AffectsCache::StatementSet& AffectsCache::get_or_compute(AffectsMap& memo, const std::string& statement,
+                                                              const Compute& compute) {
+    static const StatementSet EMPTY;
+
+    {
+        const auto lock = std::lock_guard{mutex};
+        auto it = memo.find(statement);
+        if (it != memo.end()) {
+            return it->second;
+        }
+        if (is_complete) {
+            return EMPTY;
+        }
+    }
+
+    // Computed without holding the lock; if another lookup published the set first, its result is kept
+    auto computed = compute(statement);
+    const auto lock = std::lock_guard{mutex};
+    if (is_complete) {
+        // The complete maps may be iterated by other readers, so they are no longer inserted into
+        auto it = memo.find(statement);
+        return it != memo.end() ? it->second : EMPTY;
+    }
+    // References into an unordered_map stay valid across later insertions
+    return memo.emplace(statement, std::move(computed)).first->second;
+}
@@ -1,27 +1,50 @@
 #include "pkb/stores/pattern_matching_store/assignment_store.h"
 
+#include <algorithm>
+
 AssignmentStore::AssignmentStore() = default;
 
-std::string transform_rhs(const std::string& rhs) {
-    return " " + rhs;
+void AssignmentStore::add_assignment(const StatementNumber& s, const Variable& lhs, const std::string& rhs) {
+    auto subtrees = expressions.add(rhs);
+    if (subtrees.empty()) {
+        unparsed_assignments[lhs].insert(s);
+        return;
+    }
+
+    auto root = subtrees.back();
+    auto [entry, inserted] = assignment_store.try_emplace(root);
+    entry->second[lhs].insert(s);
+    if (!inserted) {
+        return;
+    }
+
+    std::sort(subtrees.begin(), subtrees.end());
+    subtrees.erase(std::unique(subtrees.begin(), subtrees.end()), subtrees.end());
+    for (auto subtree : subtrees) {
+        roots_containing[subtree].push_back(root);
+    }
 }
 
-void AssignmentStore::add_assignment(const StatementNumber& s, const Variable& lhs, const std::string& rhs) {
-    assignment_store[transform_rhs(rhs)][lhs].insert(s);
+const std::vector<ExpressionDag::NodeId>& AssignmentStore::get_roots_containing(const std::string& rhs) const {
+    static const std::vector<ExpressionDag::NodeId> no_roots;
+
+    auto node = expressions.find(rhs);
+    if (!node.has_value()) {
+        return no_roots;
+    }
+    auto roots = roots_containing.find(*node);
+    return roots != roots_containing.end() ? roots->second : no_roots;
 }
 
 std::unordered_set<std::string> AssignmentStore::get_all_assignments_rhs(const std::string& rhs) {
-    auto rhs_transformed = transform_rhs(rhs);
-
-    if (assignment_store.find(rhs_transformed) == assignment_store.end()) {
+    auto root = expressions.find(rhs);
+    if (!root.has_value() || assignment_store.find(*root) == assignment_store.end()) {
         return {};
     }
 
-    auto lhs_stmt_map = assignment_store.at(rhs_transformed);
-
     std::unordered_set<std::string> result;
 
-    for (const auto& [lhs, stmts] : lhs_stmt_map) {
+    for (const auto& [lhs, stmts] : assignment_store.at(*root)) {
         for (const auto& stmt : stmts) {
             result.insert(stmt);
         }
@@ -32,6 +55,9 @@ std::unordered_set<std::string> AssignmentStore::get_all_assignments_rhs(const s
 
 std::unordered_set<std::string> AssignmentStore::get_all_assignments_lhs(const Variable& lhs) {
     std::unordered_set<std::string> result;
+    if (auto unparsed = unparsed_assignments.find(lhs); unparsed != unparsed_assignments.end()) {
+        result = unparsed->second;
+    }
 
     for (const auto& [rhs, stmts] : assignment_store) {
         if (stmts.find(lhs) != stmts.end()) {
@@ -46,30 +72,26 @@ std::unordered_set<std::string> AssignmentStore::get_all_assignments_lhs(const V
 
 std::unordered_set<std::string> AssignmentStore::get_all_assignments_lhs_rhs(const Variable& lhs,
                                                                              const std::string& rhs) {
-    auto rhs_transformed = transform_rhs(rhs);
-
-    if (assignment_store.find(rhs_transformed) == assignment_store.end()) {
+    auto root = expressions.find(rhs);
+    if (!root.has_value() || assignment_store.find(*root) == assignment_store.end()) {
         return {};
     }
 
-    if (assignment_store.at(rhs_transformed).find(lhs) == assignment_store.at(rhs_transformed).end()) {
+    const auto& lhs_stmts = assignment_store.at(*root);
+    if (lhs_stmts.find(lhs) == lhs_stmts.end()) {
         return {};
     }
 
-    return assignment_store.at(rhs_transformed).at(lhs);
+    return lhs_stmts.at(lhs);
 }
 
 std::unordered_set<std::string> AssignmentStore::get_all_assignments_rhs_partial(const std::string& rhs) {
     std::unordered_set<std::string> result;
 
-    auto rhs_transformed = transform_rhs(rhs);
-
-    for (const auto& [rhs_key, lhs_stmts] : assignment_store) {
-        if (rhs_key.find(rhs_transformed) != std::string::npos) {
-            for (const auto& [lhs, stmts] : lhs_stmts) {
-                for (const auto& s : stmts) {
-                    result.insert(s);
-                }
+    for (auto root : get_roots_containing(rhs)) {
+        for (const auto& [lhs, stmts] : assignment_store.at(root)) {
+            for (const auto& s : stmts) {
+                result.insert(s);
             }
         }
     }
@@ -81,17 +103,14 @@ std::unordered_set<std::string> AssignmentStore::get_all_assignments_lhs_rhs_par
                                                                                      const std::string& rhs) {
     std::unordered_set<std::string> result;
 
-    auto rhs_transformed = transform_rhs(rhs);
-
-    for (const auto& [rhs_key, lhs_stmts] : assignment_store) {
-        if (rhs_key.find(rhs_transformed) != std::string::npos) {
-            if (lhs_stmts.find(lhs) != lhs_stmts.end()) {
-                for (const auto& s : lhs_stmts.at(lhs)) {
-                    result.insert(s);
-                }
+    for (auto root : get_roots_containing(rhs)) {
+        const auto& lhs_stmts = assignment_store.at(root);
+        if (lhs_stmts.find(lhs) != lhs_stmts.end()) {
+            for (const auto& s : lhs_stmts.at(lhs)) {
+                result.insert(s);
             }
         }
     }
 
     return result;
-}
\ No newline at end of file
+}
@@ -40,3 +40,15 @@ EntityStore::VariableSet EntityStore::get_variables() const {
 EntityStore::ConstantSet EntityStore::get_constants() const {
     return constantSet;
 }
+
+std::size_t EntityStore::get_procedure_count() const {
+    return procedureSet.size();
+}
+
+std::size_t EntityStore::get_variable_count() const {
+    return variableSet.size();
+}
+
+std::size_t EntityStore::get_constant_count() const {
+    return constantSet.size();
+}
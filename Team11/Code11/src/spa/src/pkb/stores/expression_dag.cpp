@@ -0,0 +1,99 @@
+#include "pkb/stores/pattern_matching_store/expression_dag.h"
+
+#include <algorithm>
+
+static bool is_operator(std::string_view token) {
+    return token.size() == 1 && std::string_view{"+-*/%"}.find(token.front()) != std::string_view::npos;
+}
+
+/**
+ * Walks a postfix expression bottom-up, asking get_leaf and get_operator for the id of every node. Returns the ids in
+ * postfix order, or nothing if the expression is malformed or a callback has no id for a node.
+ */
+template <class NodeId, class GetLeaf, class GetOperator>
+static std::optional<std::vector<NodeId>> walk_postfix(std::string_view postfix, GetLeaf get_leaf,
+                                                       GetOperator get_operator) {
+    std::vector<NodeId> ids;
+    std::vector<NodeId> operands;
+    std::size_t pos = 0;
+    while (pos < postfix.size()) {
+        if (postfix[pos] == ' ') {
+            pos++;
+            continue;
+        }
+        auto end = std::min(postfix.find(' ', pos), postfix.size());
+        auto token = postfix.substr(pos, end - pos);
+        pos = end;
+
+        std::optional<NodeId> id;
+        if (is_operator(token)) {
+            if (operands.size() < 2) {
+                return std::nullopt;
+            }
+            auto right = operands.back();
+            operands.pop_back();
+            auto left = operands.back();
+            operands.pop_back();
+            id = get_operator(token.front(), left, right);
+        } else {
+            id = get_leaf(token);
+        }
+
+        if (!id.has_value()) {
+            return std::nullopt;
+        }
+        operands.push_back(*id);
+        ids.push_back(*id);
+    }
+
+    if (operands.size() != 1) {
+        return std::nullopt;
+    }
+    return ids;
+}
+
+std::size_t ExpressionDag::OperatorKeyHash::operator()(const OperatorKey& key) const {
+    const auto& [op, left, right] = key;
+    auto operands = (static_cast<std::uint64_t>(left) << 32) | right;
+    return std::hash<std::uint64_t>{}(operands) ^ (static_cast<std::size_t>(op) << 1);
+}
+
+std::vector<ExpressionDag::NodeId> ExpressionDag::add(std::string_view postfix) {
+    auto get_leaf = [this](std::string_view token) {
+        auto [it, inserted] = leaf_ids.try_emplace(std::string{token}, num_nodes);
+        if (inserted) {
+            num_nodes++;
+        }
+        return std::optional<NodeId>{it->second};
+    };
+    auto get_operator = [this](char op, NodeId left, NodeId right) {
+        auto [it, inserted] = operator_ids.try_emplace({op, left, right}, num_nodes);
+        if (inserted) {
+            num_nodes++;
+        }
+        return std::optional<NodeId>{it->second};
+    };
+    // The nodes of a malformed expression's complete subtrees are kept, they are just never the root of an assignment
+    return walk_postfix<NodeId>(postfix, get_leaf, get_operator).value_or(std::vector<NodeId>{});
+}
+
+std::optional<ExpressionDag::NodeId> ExpressionDag::find(std::string_view postfix) const {
+    auto get_leaf = [this](std::string_view token) -> std::optional<NodeId> {
+        auto it = leaf_ids.find(std::string{token});
+        return it != leaf_ids.end() ? std::optional<NodeId>{it->second} : std::nullopt;
+    };
+    auto get_operator = [this](char op, NodeId left, NodeId right) -> std::optional<NodeId> {
+        auto it = operator_ids.find({op, left, right});
+        return it != operator_ids.end() ? std::optional<NodeId>{it->second} : std::nullopt;
+    };
+
+    auto ids = walk_postfix<NodeId>(postfix, get_leaf, get_operator);
+    if (!ids.has_value()) {
+        return std::nullopt;
+    }
+    return ids->back();
+}
+
+std::size_t ExpressionDag::size() const {
+    return num_nodes;
+}
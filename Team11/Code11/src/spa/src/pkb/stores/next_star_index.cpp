@@ -0,0 +1,245 @@
+#include "pkb/stores/next_star_index.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace {
+/**
+ * Iterative Tarjan's algorithm over statement ids. Components are numbered in the order they are completed, so a
+ * component is always numbered after every component it reaches.
+ */
+auto tarjan_scc(std::size_t num_statements, const NextStore& next_store) -> std::vector<SymbolId> {
+    struct Frame {
+        SymbolId node;
+        const SymbolId* next_child;
+    };
+
+    std::vector<SymbolId> scc_of(num_statements, INVALID_SYMBOL_ID);
+    std::vector<SymbolId> index(num_statements, INVALID_SYMBOL_ID);
+    std::vector<SymbolId> lowlink(num_statements, 0);
+    std::vector<bool> on_stack(num_statements, false);
+    std::vector<SymbolId> stack;
+    std::vector<Frame> call_stack;
+    SymbolId index_counter = 0;
+    SymbolId scc_counter = 0;
+
+    const auto visit = [&](SymbolId node) {
+        index[node] = index_counter;
+        lowlink[node] = index_counter;
+        index_counter++;
+        stack.push_back(node);
+        on_stack[node] = true;
+        call_stack.push_back({node, next_store.get_vals_by_key(node).begin()});
+    };
+
+    for (SymbolId root = 0; root < num_statements; root++) {
+        if (index[root] != INVALID_SYMBOL_ID) {
+            continue;
+        }
+
+        visit(root);
+        while (!call_stack.empty()) {
+            const auto node = call_stack.back().node;
+            const auto* next_child = call_stack.back().next_child;
+
+            if (next_child != next_store.get_vals_by_key(node).end()) {
+                call_stack.back().next_child++;
+                const auto child = *next_child;
+                if (index[child] == INVALID_SYMBOL_ID) {
+                    visit(child);
+                } else if (on_stack[child]) {
+                    lowlink[node] = std::min(lowlink[node], index[child]);
+                }
+                continue;
+            }
+
+            call_stack.pop_back();
+            if (!call_stack.empty()) {
+                auto& parent_lowlink = lowlink[call_stack.back().node];
+                parent_lowlink = std::min(parent_lowlink, lowlink[node]);
+            }
+
+            if (lowlink[node] == index[node]) {
+                SymbolId member = INVALID_SYMBOL_ID;
+                do {
+                    member = stack.back();
+                    stack.pop_back();
+                    on_stack[member] = false;
+                    scc_of[member] = scc_counter;
+                } while (member != node);
+                scc_counter++;
+            }
+        }
+    }
+
+    return scc_of;
+}
+
+// Finds the connected CFG of every statement, ignoring edge direction
+auto find_cfgs(std::size_t num_statements, const NextStore& next_store) -> std::vector<SymbolId> {
+    std::vector<SymbolId> parent(num_statements);
+    std::iota(parent.begin(), parent.end(), 0);
+
+    const auto find = [&parent](SymbolId node) {
+        while (parent[node] != node) {
+            parent[node] = parent[parent[node]];
+            node = parent[node];
+        }
+        return node;
+    };
+
+    for (SymbolId before = 0; before < num_statements; before++) {
+        for (auto after : next_store.get_vals_by_key(before)) {
+            parent[find(after)] = find(before);
+        }
+    }
+
+    for (SymbolId node = 0; node < num_statements; node++) {
+        parent[node] = find(node);
+    }
+    return parent;
+}
+} // namespace
+
+NextStarIndex::NextStarIndex(std::size_t num_statements, const NextStore& next_store) {
+    const auto tarjan_ids = tarjan_scc(num_statements, next_store);
+    const auto cfg_of_statement = find_cfgs(num_statements, next_store);
+
+    std::size_t num_tarjan_sccs = 0;
+    for (auto id : tarjan_ids) {
+        num_tarjan_sccs = std::max<std::size_t>(num_tarjan_sccs, id + 1);
+    }
+    std::vector<SymbolId> cfg_of_tarjan_scc(num_tarjan_sccs);
+    for (SymbolId stmt = 0; stmt < num_statements; stmt++) {
+        cfg_of_tarjan_scc[tarjan_ids[stmt]] = cfg_of_statement[stmt];
+    }
+
+    // Renumber the components so that each CFG owns a consecutive range, keeping Tarjan's order within the CFG
+    std::vector<SymbolId> order(num_tarjan_sccs);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&cfg_of_tarjan_scc](SymbolId lhs, SymbolId rhs) {
+        return cfg_of_tarjan_scc[lhs] < cfg_of_tarjan_scc[rhs];
+    });
+    std::vector<SymbolId> renumbered(num_tarjan_sccs);
+    for (SymbolId scc = 0; scc < num_tarjan_sccs; scc++) {
+        renumbered[order[scc]] = scc;
+    }
+
+    scc_of_statement.resize(num_statements);
+    scc_offsets.assign(num_tarjan_sccs + 1, 0);
+    for (SymbolId stmt = 0; stmt < num_statements; stmt++) {
+        scc_of_statement[stmt] = renumbered[tarjan_ids[stmt]];
+        scc_offsets[scc_of_statement[stmt] + 1]++;
+    }
+    std::partial_sum(scc_offsets.begin(), scc_offsets.end(), scc_offsets.begin());
+    scc_statements.resize(num_statements);
+    auto fill = scc_offsets;
+    for (SymbolId stmt = 0; stmt < num_statements; stmt++) {
+        scc_statements[fill[scc_of_statement[stmt]]++] = stmt;
+    }
+
+    // Each component gets one bit per component of its CFG
+    first_scc_of_cfg.resize(num_tarjan_sccs);
+    bitset_offsets.assign(num_tarjan_sccs + 1, 0);
+    for (SymbolId first = 0; first < num_tarjan_sccs;) {
+        auto last = first;
+        while (last < num_tarjan_sccs && cfg_of_tarjan_scc[order[last]] == cfg_of_tarjan_scc[order[first]]) {
+            last++;
+        }
+        const auto words = (last - first + BITS_PER_WORD - 1) / BITS_PER_WORD;
+        for (auto scc = first; scc < last; scc++) {
+            first_scc_of_cfg[scc] = first;
+            bitset_offsets[scc + 1] = bitset_offsets[scc] + words;
+        }
+        first = last;
+    }
+    reachable_from.assign(bitset_offsets.back(), 0);
+    reaching.assign(bitset_offsets.back(), 0);
+
+    const auto set_bit = [this](std::vector<Word>& bitsets, SymbolId scc, SymbolId target) {
+        const auto local = target - first_scc_of_cfg[scc];
+        bitsets[bitset_offsets[scc] + local / BITS_PER_WORD] |= Word{1} << (local % BITS_PER_WORD);
+    };
+    const auto merge = [this](std::vector<Word>& bitsets, SymbolId into, SymbolId from) {
+        for (std::size_t word = 0; word < bitset_offsets[into + 1] - bitset_offsets[into]; word++) {
+            bitsets[bitset_offsets[into] + word] |= bitsets[bitset_offsets[from] + word];
+        }
+    };
+
+    // Successor components are numbered lower, so a forward pass sees them completed
+    for (SymbolId scc = 0; scc < num_sccs(); scc++) {
+        for (auto i = scc_offsets[scc]; i < scc_offsets[scc + 1]; i++) {
+            for (auto after : next_store.get_vals_by_key(scc_statements[i])) {
+                const auto target = scc_of_statement[after];
+                set_bit(reachable_from, scc, target);
+                if (target != scc) {
+                    merge(reachable_from, scc, target);
+                }
+            }
+        }
+    }
+
+    // Likewise predecessor components are numbered higher
+    for (auto scc = static_cast<SymbolId>(num_sccs()); scc-- > 0;) {
+        for (auto i = scc_offsets[scc]; i < scc_offsets[scc + 1]; i++) {
+            for (auto before : next_store.get_keys_by_val(scc_statements[i])) {
+                const auto source = scc_of_statement[before];
+                set_bit(reaching, scc, source);
+                if (source != scc) {
+                    merge(reaching, scc, source);
+                }
+            }
+        }
+    }
+}
+
+bool NextStarIndex::contains(SymbolId before, SymbolId after) const {
+    if (before >= scc_of_statement.size() || after >= scc_of_statement.size()) {
+        return false;
+    }
+
+    const auto source = scc_of_statement[before];
+    const auto target = scc_of_statement[after];
+    if (first_scc_of_cfg[source] != first_scc_of_cfg[target]) {
+        return false;
+    }
+
+    const auto local = target - first_scc_of_cfg[source];
+    const auto word = reachable_from[bitset_offsets[source] + local / BITS_PER_WORD];
+    return (word >> (local % BITS_PER_WORD)) & 1U;
+}
+
+std::vector<SymbolId> NextStarIndex::get_reachable_from(SymbolId before) const {
+    if (before >= scc_of_statement.size()) {
+        return {};
+    }
+    return collect(reachable_from, scc_of_statement[before]);
+}
+
+std::vector<SymbolId> NextStarIndex::get_reaching(SymbolId after) const {
+    if (after >= scc_of_statement.size()) {
+        return {};
+    }
+    return collect(reaching, scc_of_statement[after]);
+}
+
+std::size_t NextStarIndex::num_sccs() const {
+    return scc_offsets.size() - 1;
+}
+
+std::vector<SymbolId> NextStarIndex::collect(const std::vector<Word>& bitsets, SymbolId scc) const {
+    std::vector<SymbolId> statements;
+    for (auto offset = bitset_offsets[scc]; offset < bitset_offsets[scc + 1]; offset++) {
+        const auto word = bitsets[offset];
+        for (std::size_t bit = 0; bit < BITS_PER_WORD && (word >> bit) != 0; bit++) {
+            if (((word >> bit) & 1U) == 0) {
+                continue;
+            }
+            const auto local = (offset - bitset_offsets[scc]) * BITS_PER_WORD + bit;
+            const auto target = first_scc_of_cfg[scc] + local;
+            statements.insert(statements.end(), scc_statements.begin() + scc_offsets[target],
+                              scc_statements.begin() + scc_offsets[target + 1]);
+        }
+    }
+    return statements;
+}
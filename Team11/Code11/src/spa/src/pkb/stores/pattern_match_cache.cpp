@@ -0,0 +1,74 @@
+#include "pkb/stores/pattern_match_cache.h"
+
+#include <algorithm>
+#include <sstream>
+
+double PatternMatchCache::Statistics::hit_rate() const {
+    const auto lookups = hits + misses;
+    return lookups == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(lookups);
+}
+
+PatternMatchCache::PatternMatchCache(std::size_t capacity) : capacity(std::max<std::size_t>(capacity, 1)) {
+}
+
+PatternMatchCache::StatementSet PatternMatchCache::get_matches(const std::string& lhs, const std::string& postfix,
+                                                               bool is_partial, const Compute& compute) {
+    auto key = make_key(lhs, postfix, is_partial);
+    {
+        const auto lock = std::lock_guard{mutex};
+        auto it = entry_of_key.find(key);
+        if (it != entry_of_key.end()) {
+            statistics.hits++;
+            entries.splice(entries.begin(), entries, it->second);
+            if (hook) {
+                hook(statistics);
+            }
+            return entries.front().second;
+        }
+        statistics.misses++;
+    }
+
+    // Computed without holding the lock; a concurrent miss on the same key computes the same matches
+    auto matches = compute();
+    const auto lock = std::lock_guard{mutex};
+    if (entry_of_key.find(key) == entry_of_key.end()) {
+        if (entries.size() == capacity) {
+            entry_of_key.erase(entries.back().first);
+            entries.pop_back();
+            statistics.evictions++;
+        }
+        entries.emplace_front(key, matches);
+        entry_of_key.emplace(std::move(key), entries.begin());
+    }
+    if (hook) {
+        hook(statistics);
+    }
+    return matches;
+}
+
+PatternMatchCache::Statistics PatternMatchCache::get_statistics() const {
+    const auto lock = std::lock_guard{mutex};
+    return statistics;
+}
+
+void PatternMatchCache::set_hook(Hook new_hook) {
+    const auto lock = std::lock_guard{mutex};
+    hook = std::move(new_hook);
+}
+
+void PatternMatchCache::clear() {
+    const auto lock = std::lock_guard{mutex};
+    entries.clear();
+    entry_of_key.clear();
+}
+
+// The kind and lhs come first, followed by the expression's tokens separated by single spaces
+std::string PatternMatchCache::make_key(const std::string& lhs, const std::string& postfix, bool is_partial) {
+    auto key = std::string{is_partial ? "_" : "="} + lhs + '\n';
+    std::istringstream tokens(postfix);
+    for (std::string token; tokens >> token;) {
+        key += token;
+        key += ' ';
+    }
+    return key;
+}
@@ -0,0 +1,59 @@
+#include "pkb/stores/statistics_catalog.h"
+
+double RelationStatistics::get_average_fan_out() const {
+    return distinct_keys == 0 ? 0.0 : static_cast<double>(size) / static_cast<double>(distinct_keys);
+}
+
+double RelationStatistics::get_average_fan_in() const {
+    return distinct_values == 0 ? 0.0 : static_cast<double>(size) / static_cast<double>(distinct_values);
+}
+
+StatisticsCatalog::StatisticsCatalog() = default;
+
+void StatisticsCatalog::set_statement_types(const std::vector<StatementType>& statement_types) {
+    num_statements = statement_types.size();
+    statement_histogram.fill(0);
+    for (auto statement_type : statement_types) {
+        statement_histogram[static_cast<std::size_t>(statement_type)]++;
+    }
+}
+
+void StatisticsCatalog::set_entity_counts(std::size_t num_procedures, std::size_t num_variables,
+                                          std::size_t num_constants) {
+    this->num_procedures = num_procedures;
+    this->num_variables = num_variables;
+    this->num_constants = num_constants;
+}
+
+void StatisticsCatalog::set_relation_statistics(RelationshipType relationship_type,
+                                                const RelationStatistics& relation_statistics) {
+    relations[static_cast<std::size_t>(relationship_type)] = relation_statistics;
+}
+
+std::size_t StatisticsCatalog::get_statement_count() const {
+    return num_statements;
+}
+
+std::size_t StatisticsCatalog::get_statement_count(StatementType statement_type) const {
+    return statement_histogram[static_cast<std::size_t>(statement_type)];
+}
+
+const StatementTypeHistogram& StatisticsCatalog::get_statement_histogram() const {
+    return statement_histogram;
+}
+
+std::size_t StatisticsCatalog::get_procedure_count() const {
+    return num_procedures;
+}
+
+std::size_t StatisticsCatalog::get_variable_count() const {
+    return num_variables;
+}
+
+std::size_t StatisticsCatalog::get_constant_count() const {
+    return num_constants;
+}
+
+const RelationStatistics& StatisticsCatalog::get_relation_statistics(RelationshipType relationship_type) const {
+    return relations[static_cast<std::size_t>(relationship_type)];
+}
@@ -1,35 +1,20 @@
 #include "qps/evaluators/clause_evaluators/clause_evaluator.hpp"
 
-auto qps::ClauseEvaluator::negate_result(qps::OutputTable output_table) const -> qps::OutputTable {
-    return std::visit(overloaded{[](const UnitTable&) -> qps::OutputTable {
-                                     return Table{};
-                                 },
-                                 [this](const Table& table) -> qps::OutputTable {
-                                     if (is_empty(table)) {
-                                         return UnitTable{};
-                                     }
-                                     auto column_synonyms = table.get_column();
-                                     // [EXPENSIVE] for each synonym, do a synonym.scan(read_facade) and put into a
-                                     // table. cross join all these tables.
-                                     auto curr_table = OutputTable{UnitTable{}};
-                                     for (const auto& synonym : column_synonyms) {
-                                         const auto all_stored_synonyms = get_data(synonym);
-                                         auto new_table = Table{{synonym}};
-                                         for (const auto& stored_syn : all_stored_synonyms) {
-                                             new_table.add_row({stored_syn});
-                                         }
-                                         curr_table = join(std::move(curr_table), std::move(new_table));
-                                     }
-                                     auto final_table = subtract(std::move(curr_table), table, read_facade);
-                                     return final_table;
-                                 }},
-                      output_table);
+auto qps::ClauseEvaluator::choose_access_path(const std::unordered_set<std::string>& keys,
+                                               const std::unordered_set<std::string>& values,
+                                               RelationshipType relationship_type) const -> AccessPath {
+    // A probe costs a lookup per candidate and a scan a pair of set lookups per related pair
+    const auto num_candidates = std::min(keys.size(), values.size());
+    const auto relation_size = read_facade->get_relationship_size(relationship_type);
+    const auto access_path = num_candidates < relation_size ? AccessPath::Probe : AccessPath::Scan;
+    access_path_choice = AccessPathChoice{access_path, num_candidates, relation_size};
+    return access_path;
 }
 
 auto qps::ClauseEvaluator::evaluate() const -> OutputTable {
-    if (is_negated) {
-        return negate_result(evaluate_positive());
+    if (demand.is_existence_only) {
+        return has_witness() ? OutputTable{UnitTable{}} : OutputTable{Table{}};
     } else {
-        return evaluate_positive();
+        return drop_columns(evaluate_positive(), demand.unneeded);
     }
 }
@@ -1,6 +1,7 @@
 #include "qps/evaluators/clause_evaluators/relationship/affects_evaluator.hpp"
-#include "qps/utils/affects_conditions.h"
-#include "qps/utils/algo.h"
+
+#include <algorithm>
+#include <optional>
 
 namespace qps {
 
@@ -16,38 +17,11 @@ auto AffectsEvaluator::evaluate_positive() const -> OutputTable {
 
 auto AffectsEvaluator::eval_affects(const std::shared_ptr<StmtSynonym>& stmt_syn_1, const Integer& stmt_num_2) const
     -> OutputTable {
-    // TODO: We should optimise this (current implementation is quite naive)
-    auto relevant_stmts = get_data(stmt_syn_1);
+    const auto relevant_stmts = get_data(stmt_syn_1);
     auto table = Table{{stmt_syn_1}};
 
-    // Get all variables used by stmt_num_2
-    auto used_vars = read_facade->get_vars_used_by_statement(stmt_num_2.value);
-
-    std::unordered_set<std::string> filtered_stmts;
-
-    // From the relevant statements, filter such that they are only assign statements and
-    // the stmts modify any of the used vars (assignment statements only modify one var)
-    for (const auto& stmt : relevant_stmts) {
-        if (!read_facade->has_assign_statement(stmt)) {
-            continue;
-        }
-
-        auto modified_var = *read_facade->get_vars_modified_by_statement(stmt).begin();
-        if (used_vars.find(modified_var) != used_vars.end()) {
-            filtered_stmts.insert(stmt);
-        }
-    }
-
-    auto next_map = read_facade->get_all_next();
-
-    // For all filtered statements
-    for (const auto& stmt : filtered_stmts) {
-        auto affect_conds = AffectsConditions(stmt, read_facade);
-        auto has_transitive =
-            has_transitive_rs(stmt, {stmt_num_2.value}, next_map, affect_conds.get_start_node_cond(),
-                              affect_conds.get_end_node_cond(), affect_conds.get_intermediate_node_cond());
-
-        if (has_transitive) {
+    for (const auto& stmt : read_facade->view_affecting(stmt_num_2.value)) {
+        if (relevant_stmts.find(stmt) != relevant_stmts.end()) {
             table.add_row({stmt});
         }
     }
@@ -57,24 +31,11 @@ auto AffectsEvaluator::eval_affects(const std::shared_ptr<StmtSynonym>& stmt_syn
 
 auto AffectsEvaluator::eval_affects(const std::shared_ptr<StmtSynonym>& stmt_syn_1, const WildCard&) const
     -> OutputTable {
-    // TODO: Possibly optimise?
     const auto relevant_stmts = get_data(stmt_syn_1);
-    auto next_map = read_facade->get_all_next();
-
-    // get all statements
-    auto all_stmts = read_facade->get_all_statements();
-
     auto table = Table{{stmt_syn_1}};
 
-    // Get only the relevant_stmts that have transitive relationship with any other stmt
-    for (const auto& stmt : relevant_stmts) {
-        auto affect_conds = AffectsConditions(stmt, read_facade);
-
-        auto has_transitive =
-            has_transitive_rs(stmt, all_stmts, next_map, affect_conds.get_start_node_cond(),
-                              affect_conds.get_end_node_cond(), affect_conds.get_intermediate_node_cond());
-
-        if (has_transitive) {
+    for (const auto& [stmt, affected] : read_facade->get_all_affects()) {
+        if (!affected.empty() && relevant_stmts.find(stmt) != relevant_stmts.end()) {
             table.add_row({stmt});
         }
     }
@@ -86,60 +47,69 @@ auto AffectsEvaluator::eval_affects(const Integer& stmt_num_1, const std::shared
     -> OutputTable {
     const auto relevant_stmts = get_data(stmt_syn_2);
     auto table = Table{{stmt_syn_2}};
-    const auto next_map = read_facade->get_all_next();
-
-    auto affect_conds = AffectsConditions(stmt_num_1.value, read_facade);
 
-    auto new_rows =
-        get_all_transitive_from_node(stmt_num_1.value, next_map, affect_conds.get_start_node_cond(),
-                                     affect_conds.get_end_node_cond(), affect_conds.get_intermediate_node_cond());
-
-    for (const auto& row : new_rows) {
-        if (relevant_stmts.find(row) != relevant_stmts.end()) {
-            table.add_row({row});
+    for (const auto& stmt : read_facade->view_affected_by(stmt_num_1.value)) {
+        if (relevant_stmts.find(stmt) != relevant_stmts.end()) {
+            table.add_row({stmt});
         }
     }
+
     return table;
 }
 
 auto AffectsEvaluator::eval_affects(const std::shared_ptr<StmtSynonym>& stmt_syn_1,
                                     const std::shared_ptr<StmtSynonym>& stmt_syn_2) const -> OutputTable {
-    // TODO: Possibly optimise
-    auto next_map = read_facade->get_all_next();
-    auto relevant_stmts_1 = get_data(stmt_syn_1);
+    // The branches that read the whole relation compute it in one dataflow pass per procedure
+    const auto relevant_stmts_1 = get_data(stmt_syn_1);
 
     if (stmt_syn_1 == stmt_syn_2) {
         Table table{{stmt_syn_1}};
 
-        for (const auto& stmt : relevant_stmts_1) {
-            auto affect_conds = AffectsConditions(stmt, read_facade);
-            auto has_transitive =
-                has_transitive_rs(stmt, {stmt}, next_map, affect_conds.get_start_node_cond(),
-                                  affect_conds.get_end_node_cond(), affect_conds.get_intermediate_node_cond());
-
-            if (has_transitive) {
+        for (const auto& [stmt, affected] : read_facade->get_all_affects()) {
+            if (affected.find(stmt) != affected.end() && relevant_stmts_1.find(stmt) != relevant_stmts_1.end()) {
                 table.add_row({stmt});
             }
         }
         return table;
     }
 
-    auto relevant_stmts_2 = get_data(stmt_syn_2);
+    const auto relevant_stmts_2 = get_data(stmt_syn_2);
+    if (!is_needed(stmt_syn_2)) {
+        // Only the distinct statements affecting some statement of stmt_syn_2 are needed
+        auto table = Table{{stmt_syn_1}};
+        for (const auto& [stmt_1, affected] : read_facade->get_all_affects()) {
+            if (relevant_stmts_1.find(stmt_1) == relevant_stmts_1.end()) {
+                continue;
+            }
+            if (std::any_of(affected.begin(), affected.end(), [&relevant_stmts_2](const auto& stmt_2) {
+                    return relevant_stmts_2.find(stmt_2) != relevant_stmts_2.end();
+                })) {
+                table.add_row({stmt_1});
+            }
+        }
+        return table;
+    } else if (!is_needed(stmt_syn_1)) {
+        auto table = Table{{stmt_syn_2}};
+        for (const auto& stmt_2 : relevant_stmts_2) {
+            const auto affecting = read_facade->view_affecting(stmt_2);
+            if (std::any_of(affecting.begin(), affecting.end(), [&relevant_stmts_1](const auto& stmt_1) {
+                    return relevant_stmts_1.find(stmt_1) != relevant_stmts_1.end();
+                })) {
+                table.add_row({stmt_2});
+            }
+        }
+        return table;
+    }
 
     auto table = Table{{stmt_syn_1, stmt_syn_2}};
 
-    for (const auto& stmt_1 : relevant_stmts_1) {
-        auto affect_conds = AffectsConditions(stmt_1, read_facade);
-
-        // use get_all_transitive_from_node
-        auto new_rows =
-            get_all_transitive_from_node(stmt_1, next_map, affect_conds.get_start_node_cond(),
-                                         affect_conds.get_end_node_cond(), affect_conds.get_intermediate_node_cond());
-
-        // for each new row
-        for (const auto& row : new_rows) {
-            if (relevant_stmts_2.find(row) != relevant_stmts_2.end()) {
-                table.add_row({stmt_1, row});
+    for (const auto& [stmt_1, affected] : read_facade->get_all_affects()) {
+        if (relevant_stmts_1.find(stmt_1) == relevant_stmts_1.end()) {
+            continue;
+        }
+        for (const auto& stmt_2 : affected) {
+            if (relevant_stmts_2.find(stmt_2) != relevant_stmts_2.end()) {
+                table.add_row({stmt_1, stmt_2});
             }
         }
     }
@@ -148,15 +118,7 @@ auto AffectsEvaluator::eval_affects(const std::shared_ptr<StmtSynonym>& stmt_syn
 }
 
 auto AffectsEvaluator::eval_affects(const Integer& stmt_num_1, const Integer& stmt_num_2) const -> OutputTable {
-    const auto next_map = read_facade->get_all_next();
-
-    auto affect_conds = AffectsConditions(stmt_num_1.value, read_facade);
-
-    auto has_transitive =
-        has_transitive_rs(stmt_num_1.value, {stmt_num_2.value}, next_map, affect_conds.get_start_node_cond(),
-                          affect_conds.get_end_node_cond(), affect_conds.get_intermediate_node_cond());
-
-    if (has_transitive) {
+    if (read_facade->has_affects_relation(stmt_num_1.value, stmt_num_2.value)) {
         return UnitTable{};
     }
 
@@ -164,28 +126,7 @@ auto AffectsEvaluator::eval_affects(const Integer& stmt_num_1, const Integer& st
 }
 
 auto AffectsEvaluator::eval_affects(const Integer& stmt_num_1, const WildCard&) const -> OutputTable {
-    const auto next_map = read_facade->get_all_next();
-
-    auto affect_conds = AffectsConditions(stmt_num_1.value, read_facade);
-
-    // Get the vars modified by stmt_num_1
-    auto mod_vars = read_facade->get_vars_modified_by_statement(stmt_num_1.value);
-
-    // If mod_vars size is not 1, return empty table
-    if (mod_vars.size() != 1) {
-        return Table{};
-    }
-
-    auto mod_var = *mod_vars.begin();
-
-    // Get all stmts that use the mod_var
-    auto used_stmts = read_facade->get_statements_that_use_var(mod_var);
-
-    auto has_transitive =
-        has_transitive_rs(stmt_num_1.value, used_stmts, next_map, affect_conds.get_start_node_cond(),
-                          affect_conds.get_end_node_cond(), affect_conds.get_intermediate_node_cond());
-
-    if (has_transitive) {
+    if (!read_facade->view_affected_by(stmt_num_1.value).empty()) {
         return UnitTable{};
     }
 
@@ -194,40 +135,14 @@ auto AffectsEvaluator::eval_affects(const Integer& stmt_num_1, const WildCard&)
 
 auto AffectsEvaluator::eval_affects(const WildCard&, const std::shared_ptr<StmtSynonym>& stmt_syn_2) const
     -> OutputTable {
-    // TODO: We should optimise this (current implementation is quite naive)
-    auto relevant_stmts = get_data(stmt_syn_2);
-    auto next_map = read_facade->get_all_next();
-
+    const auto relevant_stmts = get_data(stmt_syn_2);
     auto table = Table({stmt_syn_2});
 
-    // For each stmt in relevant_stmts
+    // Computing the whole relation first makes every lookup below a cache hit
+    read_facade->get_all_affects();
     for (const auto& stmt : relevant_stmts) {
-        // Get all variables used by stmt
-        auto used_vars = read_facade->get_vars_used_by_statement(stmt);
-
-        // Get all assign statements that modify any of the used vars
-        auto assign_stmts = read_facade->get_assign_statements();
-
-        std::unordered_set<std::string> filtered_stmts;
-
-        for (const auto& assign_stmt : assign_stmts) {
-            auto modified_var = *read_facade->get_vars_modified_by_statement(assign_stmt).begin();
-            if (used_vars.find(modified_var) != used_vars.end()) {
-                filtered_stmts.insert(assign_stmt);
-            }
-        }
-
-        // For each filtered_stmt
-        for (const auto& filtered_stmt : filtered_stmts) {
-            // Get all transitive stmts from stmt
-            auto affect_conds = AffectsConditions(filtered_stmt, read_facade);
-            auto has_transitive =
-                has_transitive_rs(filtered_stmt, {stmt}, next_map, affect_conds.get_start_node_cond(),
-                                  affect_conds.get_end_node_cond(), affect_conds.get_intermediate_node_cond());
-
-            if (has_transitive) {
-                table.add_row({stmt});
-            }
+        if (!read_facade->view_affecting(stmt).empty()) {
+            table.add_row({stmt});
         }
     }
 
@@ -235,60 +150,60 @@ auto AffectsEvaluator::eval_affects(const WildCard&, const std::shared_ptr<StmtS
 }
 
 auto AffectsEvaluator::eval_affects(const WildCard&, const Integer& stmt_num_2) const -> OutputTable {
-    // TODO: We should optimise this (current implementation is quite naive)
-    // Get all variables used by stmt_num_2
-    auto used_vars = read_facade->get_vars_used_by_statement(stmt_num_2.value);
-
-    // Get all assign statements that modify any of the used vars
-    auto assign_stmts = read_facade->get_assign_statements();
+    if (!read_facade->view_affecting(stmt_num_2.value).empty()) {
+        return UnitTable{};
+    }
 
-    auto filtered_stmts = std::unordered_set<std::string>{};
+    return Table{};
+}
 
-    for (const auto& stmt : assign_stmts) {
-        auto modified_var = *read_facade->get_vars_modified_by_statement(stmt).begin();
-        if (used_vars.find(modified_var) != used_vars.end()) {
-            filtered_stmts.insert(stmt);
-        }
+auto AffectsEvaluator::has_witness() const -> bool {
+    const auto* stmt_syn_1 = std::get_if<std::shared_ptr<StmtSynonym>>(&affects.stmt1);
+    const auto* stmt_syn_2 = std::get_if<std::shared_ptr<StmtSynonym>>(&affects.stmt2);
+    if (std::holds_alternative<Integer>(affects.stmt1) || std::holds_alternative<Integer>(affects.stmt2) ||
+        (stmt_syn_1 == nullptr && stmt_syn_2 == nullptr)) {
+        // These cases already look at a single statement or stop early
+        return !is_empty(evaluate_positive());
     }
-    auto next_map = read_facade->get_all_next();
-
-    // For each filtered_stmt
-    for (const auto& stmt : filtered_stmts) {
-        // Get all transitive stmts from stmt_num_2
-        auto affect_conds = AffectsConditions(stmt, read_facade);
-        auto has_transitive =
-            has_transitive_rs(stmt, {stmt_num_2.value}, next_map, affect_conds.get_start_node_cond(),
-                              affect_conds.get_end_node_cond(), affect_conds.get_intermediate_node_cond());
 
-        if (has_transitive) {
-            return UnitTable{};
-        }
+    if (stmt_syn_1 != nullptr && stmt_syn_2 != nullptr && *stmt_syn_1 == *stmt_syn_2) {
+        const auto relevant_stmts = get_data(*stmt_syn_1);
+        return std::any_of(relevant_stmts.begin(), relevant_stmts.end(), [this](const auto& stmt) {
+            return read_facade->has_affects_relation(stmt, stmt);
+        });
     }
 
-    return Table{};
+    // Probe the affects of one statement at a time from the smaller bound side, so that only the procedures of the
+    // statements probed are analysed
+    const auto relevant_stmts_1 = stmt_syn_1 != nullptr ? std::make_optional(get_data(*stmt_syn_1)) : std::nullopt;
+    const auto relevant_stmts_2 = stmt_syn_2 != nullptr ? std::make_optional(get_data(*stmt_syn_2)) : std::nullopt;
+    const auto has_any = [](const SetView<std::string>& stmts,
+                            const std::optional<std::unordered_set<std::string>>& relevant_stmts) {
+        return std::any_of(stmts.begin(), stmts.end(), [&relevant_stmts](const auto& stmt) {
+            return !relevant_stmts.has_value() || relevant_stmts->find(stmt) != relevant_stmts->end();
+        });
+    };
+
+    const auto is_first_smaller =
+        relevant_stmts_1.has_value() &&
+        (!relevant_stmts_2.has_value() || relevant_stmts_1->size() <= relevant_stmts_2->size());
+    if (is_first_smaller) {
+        return std::any_of(relevant_stmts_1->begin(), relevant_stmts_1->end(), [&](const auto& stmt_1) {
+            return has_any(read_facade->view_affected_by(stmt_1), relevant_stmts_2);
+        });
+    }
+    return std::any_of(relevant_stmts_2->begin(), relevant_stmts_2->end(), [&](const auto& stmt_2) {
+        return has_any(read_facade->view_affecting(stmt_2), relevant_stmts_1);
+    });
 }
 
 auto AffectsEvaluator::eval_affects(const WildCard&, const WildCard&) const -> OutputTable {
-    // TODO: Possibly optimise?
-    const auto relevant_stmts = read_facade->get_assign_statements();
-    auto next_map = read_facade->get_all_next();
-
-    // get all statements
-    auto all_stmts = read_facade->get_all_statements();
-
-    // Get only the relevant_stmts that have transitive relationship with any other stmt
-    for (const auto& stmt : relevant_stmts) {
-        auto affect_conds = AffectsConditions(stmt, read_facade);
-
-        auto has_transitive =
-            has_transitive_rs(stmt, all_stmts, next_map, affect_conds.get_start_node_cond(),
-                              affect_conds.get_end_node_cond(), affect_conds.get_intermediate_node_cond());
-
-        if (has_transitive) {
+    for (const auto& [_, affected] : read_facade->get_all_affects()) {
+        if (!affected.empty()) {
             return UnitTable{};
         }
     }
 
     return Table{};
 }
-} // namespace qps
\ No newline at end of file
+} // namespace qps
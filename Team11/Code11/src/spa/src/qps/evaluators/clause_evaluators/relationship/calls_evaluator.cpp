@@ -18,12 +18,34 @@ auto CallsEvaluator::eval_calls(const std::shared_ptr<ProcSynonym>& proc_syn_1,
     if (proc_syn_1 == proc_syn_2) {
         return Table{};
     }
-    // TODO improve pkb api with get all caller-callee pairs
+    const auto relevant_procs_1 = get_data(proc_syn_1);
+    const auto relevant_procs_2 = get_data(proc_syn_2);
+
     auto table = Table{{proc_syn_1, proc_syn_2}};
+    if (choose_access_path(relevant_procs_1, relevant_procs_2, RelationshipType::Calls) == AccessPath::Probe) {
+        probe(
+            table, relevant_procs_1, relevant_procs_2,
+            [this](const std::string& caller) {
+                return read_facade->get_callees(caller);
+            },
+            [this](const std::string& callee) {
+                return read_facade->get_callers(callee);
+            });
+        return table;
+    }
+
+    // TODO improve pkb api with get all caller-callee pairs
     const auto all_callers = read_facade->get_all_calls_callers();
     for (const auto& caller : all_callers) {
+        if (relevant_procs_1.find(caller) == relevant_procs_1.end()) {
+            continue;
+        }
+
         const auto callees = read_facade->get_callees(caller);
         for (const auto& callee : callees) {
+            if (relevant_procs_2.find(callee) == relevant_procs_2.end()) {
+                continue;
+            }
             table.add_row({caller, callee});
         }
     }
@@ -1,5 +1,8 @@
 #include "qps/evaluators/clause_evaluators/relationship/follows_evaluator.hpp"
 
+#include <array>
+#include <string>
+
 namespace qps {
 
 auto FollowsEvaluator::select_eval_method() const {
@@ -21,12 +24,25 @@ auto FollowsEvaluator::eval_follows(const std::shared_ptr<StmtSynonym>& stmt_syn
     const auto relevant_stmts_2 = get_data(stmt_syn_2);
 
     auto table = Table{{stmt_syn_1, stmt_syn_2}};
+    if (choose_access_path(relevant_stmts_1, relevant_stmts_2, RelationshipType::Follows) == AccessPath::Probe) {
+        // A statement has at most one statement directly following it, and one it directly follows
+        probe(
+            table, relevant_stmts_1, relevant_stmts_2,
+            [this](const std::string& stmt) {
+                return std::array<std::string, 1>{read_facade->get_statement_following(stmt)};
+            },
+            [this](const std::string& stmt) {
+                return std::array<std::string, 1>{read_facade->get_statement_followed_by(stmt)};
+            });
+        return table;
+    }
+
     const auto follows_map = read_facade->get_all_follows();
     for (const auto& follows_pair : follows_map) {
         if (relevant_stmts_1.find(follows_pair.first) == relevant_stmts_1.end()) {
             continue;
         }
-        if (relevant_stmts_2.find(follows_pair.second) == relevant_stmts_1.end()) {
+        if (relevant_stmts_2.find(follows_pair.second) == relevant_stmts_2.end()) {
             continue;
         }
         table.add_row({follows_pair.first, follows_pair.second});
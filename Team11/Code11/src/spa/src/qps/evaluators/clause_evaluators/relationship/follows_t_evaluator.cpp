@@ -21,6 +21,18 @@ auto FollowsTEvaluator::eval_follows_t(const std::shared_ptr<StmtSynonym>& stmt_
     const auto relevant_stmts_2 = get_data(stmt_syn_2);
 
     auto table = Table{{stmt_syn_1, stmt_syn_2}};
+    if (choose_access_path(relevant_stmts_1, relevant_stmts_2, RelationshipType::FollowsStar) == AccessPath::Probe) {
+        probe(
+            table, relevant_stmts_1, relevant_stmts_2,
+            [this](const std::string& stmt) {
+                return read_facade->view_follows_stars_following(stmt);
+            },
+            [this](const std::string& stmt) {
+                return read_facade->view_follows_stars_by(stmt);
+            });
+        return table;
+    }
+
     const auto follows_star_map = read_facade->get_all_follows_star();
     for (const auto& stmt_and_followers : follows_star_map) {
         if (relevant_stmts_1.find(stmt_and_followers.first) == relevant_stmts_1.end()) {
@@ -28,7 +40,7 @@ auto FollowsTEvaluator::eval_follows_t(const std::shared_ptr<StmtSynonym>& stmt_
         }
 
         for (const auto& follower : stmt_and_followers.second) {
-            if (relevant_stmts_2.find(follower) == relevant_stmts_1.end()) {
+            if (relevant_stmts_2.find(follower) == relevant_stmts_2.end()) {
                 continue;
             }
             table.add_row({stmt_and_followers.first, follower});
@@ -42,7 +54,7 @@ auto FollowsTEvaluator::eval_follows_t(const std::shared_ptr<StmtSynonym>& stmt_
     -> OutputTable {
     const auto relevant_stmts = get_data(stmt_syn_1);
     auto table = Table{{stmt_syn_1}};
-    const auto followed_stmts = read_facade->get_follows_stars_by(stmt_num_2.value);
+    const auto followed_stmts = read_facade->view_follows_stars_by(stmt_num_2.value);
     for (const auto& stmt : followed_stmts) {
         if (relevant_stmts.find(stmt) == relevant_stmts.end()) {
             continue;
@@ -72,7 +84,7 @@ auto FollowsTEvaluator::eval_follows_t(const Integer& stmt_num_1, const std::sha
     -> OutputTable {
     const auto relevant_stmts = get_data(stmt_syn_2);
     auto table = Table({stmt_syn_2});
-    const auto all_followers_of_stmt = read_facade->get_follows_stars_following(stmt_num_1.value);
+    const auto all_followers_of_stmt = read_facade->view_follows_stars_following(stmt_num_1.value);
     for (const auto& follower : all_followers_of_stmt) {
         if (relevant_stmts.find(follower) == relevant_stmts.end()) {
             continue;
@@ -16,13 +16,32 @@ auto ModifiesPEvaluator::evaluate_positive() const -> OutputTable {
 
 auto ModifiesPEvaluator::eval_modifies_p(const std::shared_ptr<ProcSynonym>& proc_synonym,
                                          const std::shared_ptr<VarSynonym>& var_synonym) const -> OutputTable {
+    const auto relevant_procs = get_data(proc_synonym);
+    const auto relevant_variables = get_data(var_synonym);
+
     auto table = Table{{proc_synonym, var_synonym}};
-    const auto all_proc_var_modify_pairs = read_facade->get_all_procedures_and_var_modify_pairs();
+    if (choose_access_path(relevant_procs, relevant_variables, RelationshipType::ModifiesP) == AccessPath::Probe) {
+        probe(
+            table, relevant_procs, relevant_variables,
+            [this](const std::string& proc) {
+                return read_facade->get_vars_modified_by_procedure(proc);
+            },
+            [this](const std::string& var) {
+                return read_facade->get_procedures_that_modify_var(var);
+            });
+        return table;
+    }
 
-    for (const auto& pair : all_proc_var_modify_pairs) {
-        const auto proc = std::get<0>(pair);
-        const auto var_modified = std::get<1>(pair);
-        table.add_row({proc, var_modified});
+    const auto all_pairs = read_facade->get_all_procedures_and_var_modify_pairs();
+    for (const auto& pair : all_pairs) {
+        const auto& [proc, var] = pair;
+        if (relevant_procs.find(proc) == relevant_procs.end()) {
+            continue;
+        }
+        if (relevant_variables.find(var) == relevant_variables.end()) {
+            continue;
+        }
+        table.add_row({proc, var});
     }
     return table;
 }
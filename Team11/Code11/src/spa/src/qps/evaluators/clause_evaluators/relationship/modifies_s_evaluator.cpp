@@ -22,20 +22,30 @@ auto ModifiesSEvaluator::eval_modifies_s(const std::shared_ptr<qps::StmtSynonym>
     const auto relevant_stmts = get_data(stmt_synonym);
     const auto relevant_variables = get_data(var_syn);
 
-    const auto stmt_vec = std::vector<std::string>{relevant_stmts.begin(), relevant_stmts.end()};
-    const auto var_vec = std::vector<std::string>{relevant_variables.begin(), relevant_variables.end()};
-
     auto table = Table{{stmt_synonym, var_syn}};
+    if (choose_access_path(relevant_stmts, relevant_variables, RelationshipType::ModifiesS) == AccessPath::Probe) {
+        probe(
+            table, relevant_stmts, relevant_variables,
+            [this](const std::string& stmt) {
+                return read_facade->get_vars_modified_by_statement(stmt);
+            },
+            [this](const std::string& var) {
+                return read_facade->get_statements_that_modify_var(var);
+            });
+        return table;
+    }
 
     const auto all_pairs = read_facade->get_all_statements_and_var_modify_pairs();
-    for (const auto& stmt : stmt_vec) {
-        for (const auto& v : var_vec) {
-            if (all_pairs.find({stmt, v}) != all_pairs.end()) {
-                table.add_row({stmt, v});
-            }
+    for (const auto& pair : all_pairs) {
+        const auto& [stmt, var] = pair;
+        if (relevant_stmts.find(stmt) == relevant_stmts.end()) {
+            continue;
+        }
+        if (relevant_variables.find(var) == relevant_variables.end()) {
+            continue;
         }
+        table.add_row({stmt, var});
     }
-
     return table;
 }
 
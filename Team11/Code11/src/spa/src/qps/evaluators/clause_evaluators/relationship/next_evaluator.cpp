@@ -23,13 +23,25 @@ auto NextEvaluator::eval_next(const std::shared_ptr<StmtSynonym>& stmt_syn_1,
     const auto relevant_stmts_2 = get_data(stmt_syn_2);
 
     auto table = Table{{stmt_syn_1, stmt_syn_2}};
+    if (choose_access_path(relevant_stmts_1, relevant_stmts_2, RelationshipType::Next) == AccessPath::Probe) {
+        probe(
+            table, relevant_stmts_1, relevant_stmts_2,
+            [this](const std::string& stmt) {
+                return read_facade->view_next_of(stmt);
+            },
+            [this](const std::string& stmt) {
+                return read_facade->view_previous_of(stmt);
+            });
+        return table;
+    }
+
     const auto all_next_keys = read_facade->get_all_next_keys();
     for (const auto& next_key : all_next_keys) {
         if (relevant_stmts_1.find(next_key) == relevant_stmts_1.end()) {
             continue;
         }
 
-        const auto all_values_of_key = read_facade->get_next_of(next_key);
+        const auto all_values_of_key = read_facade->view_next_of(next_key);
         for (const auto& next_value : all_values_of_key) {
             if (relevant_stmts_2.find(next_value) == relevant_stmts_2.end()) {
                 continue;
@@ -45,7 +57,7 @@ auto NextEvaluator::eval_next(const std::shared_ptr<StmtSynonym>& stmt_syn_1, co
     -> OutputTable {
     const auto relevant_stmts = get_data(stmt_syn_1);
     auto table = Table{{stmt_syn_1}};
-    const auto stmt_candidates = read_facade->get_previous_of(stmt_num_2.value);
+    const auto stmt_candidates = read_facade->view_previous_of(stmt_num_2.value);
     for (const auto& candidate : stmt_candidates) {
         if (relevant_stmts.find(candidate) != relevant_stmts.end()) {
             table.add_row({candidate});
@@ -73,7 +85,7 @@ auto NextEvaluator::eval_next(const Integer& stmt_num_1, const std::shared_ptr<S
     -> OutputTable {
     const auto relevant_stmts = get_data(stmt_syn_2);
     auto table = Table{{stmt_syn_2}};
-    const auto stmt_candidates = read_facade->get_next_of(stmt_num_1.value);
+    const auto stmt_candidates = read_facade->view_next_of(stmt_num_1.value);
     for (const auto& candidate : stmt_candidates) {
         if (relevant_stmts.find(candidate) != relevant_stmts.end()) {
             table.add_row({candidate});
@@ -1,5 +1,6 @@
 #include "qps/evaluators/clause_evaluators/relationship/next_t_evaluator.hpp"
 #include "qps/utils/algo.h"
+#include <algorithm>
 #include <stack>
 
 namespace qps {
@@ -14,13 +15,24 @@ auto NextTEvaluator::evaluate_positive() const -> OutputTable {
     return std::visit(select_eval_method(), next_t.stmt1, next_t.stmt2);
 }
 
+auto NextTEvaluator::next_of() const -> Neighbours {
+    return [this](const std::string& stmt) {
+        return read_facade->view_next_of(stmt);
+    };
+}
+
+auto NextTEvaluator::previous_of() const -> Neighbours {
+    return [this](const std::string& stmt) {
+        return read_facade->view_previous_of(stmt);
+    };
+}
+
 auto NextTEvaluator::eval_next_t(const std::shared_ptr<StmtSynonym>& stmt_syn_1, const Integer& stmt_num_2) const
     -> OutputTable {
     const auto relevant_stmts = get_data(stmt_syn_1);
     auto table = Table{{stmt_syn_1}};
-    const auto next_reverse_map = read_facade->get_all_next_reverse();
-
-    auto new_rows = get_all_transitive_from_node(stmt_num_2.value, next_reverse_map);
+    auto new_rows = read_facade->has_next_star_index() ? read_facade->get_previous_star_of(stmt_num_2.value)
+                                                       : get_all_transitive_from_node(stmt_num_2.value, previous_of());
 
     for (const auto& row : new_rows) {
         if (relevant_stmts.find(row) != relevant_stmts.end()) {
@@ -51,9 +63,8 @@ auto NextTEvaluator::eval_next_t(const Integer& stmt_num_1, const std::shared_pt
     const auto relevant_stmts = get_data(stmt_syn_2);
     auto table = Table{{stmt_syn_2}};
 
-    const auto next_map = read_facade->get_all_next();
-
-    auto new_rows = get_all_transitive_from_node(stmt_num_1.value, next_map);
+    auto new_rows = read_facade->has_next_star_index() ? read_facade->get_next_star_of(stmt_num_1.value)
+                                                       : get_all_transitive_from_node(stmt_num_1.value, next_of());
 
     for (const auto& row : new_rows) {
         if (relevant_stmts.find(row) != relevant_stmts.end()) {
@@ -66,6 +77,10 @@ auto NextTEvaluator::eval_next_t(const Integer& stmt_num_1, const std::shared_pt
 
 auto NextTEvaluator::eval_next_t(const std::shared_ptr<StmtSynonym>& stmt_syn_1,
                                  const std::shared_ptr<StmtSynonym>& stmt_syn_2) const -> OutputTable {
+    if (read_facade->has_next_star_index()) {
+        return eval_next_t_indexed(stmt_syn_1, stmt_syn_2);
+    }
+
     const auto next_map = read_facade->get_all_next();
 
     auto next_star_pairs = get_next_star_pairs(next_map);
@@ -98,10 +113,61 @@ auto NextTEvaluator::eval_next_t(const std::shared_ptr<StmtSynonym>& stmt_syn_1,
     return table;
 }
 
-auto NextTEvaluator::eval_next_t(const Integer& stmt_num_1, const Integer& stmt_num_2) const -> OutputTable {
-    const auto next_map = read_facade->get_all_next();
+auto NextTEvaluator::eval_next_t_indexed(const std::shared_ptr<StmtSynonym>& stmt_syn_1,
+                                         const std::shared_ptr<StmtSynonym>& stmt_syn_2) const -> OutputTable {
+    const auto relevant_stmts_1 = get_data(stmt_syn_1);
 
-    bool has_transitive = has_transitive_rs(stmt_num_1.value, {stmt_num_2.value}, next_map);
+    if (stmt_syn_1 == stmt_syn_2) {
+        Table table{{stmt_syn_1}};
+        for (const auto& stmt : relevant_stmts_1) {
+            if (read_facade->has_next_star_relation(stmt, stmt)) {
+                table.add_row({stmt});
+            }
+        }
+        return table;
+    }
+
+    const auto relevant_stmts_2 = get_data(stmt_syn_2);
+    if (!is_needed(stmt_syn_2)) {
+        // Only the distinct statements of stmt_syn_1 that reach some statement of stmt_syn_2 are needed
+        Table table{{stmt_syn_1}};
+        for (const auto& stmt1 : relevant_stmts_1) {
+            if (reaches_any(stmt1, relevant_stmts_2)) {
+                table.add_row({stmt1});
+            }
+        }
+        return table;
+    } else if (!is_needed(stmt_syn_1)) {
+        Table table{{stmt_syn_2}};
+        for (const auto& stmt2 : relevant_stmts_2) {
+            const auto previous_stmts = read_facade->get_previous_star_of(stmt2);
+            if (std::any_of(previous_stmts.begin(), previous_stmts.end(), [&relevant_stmts_1](const auto& stmt1) {
+                    return relevant_stmts_1.find(stmt1) != relevant_stmts_1.end();
+                })) {
+                table.add_row({stmt2});
+            }
+        }
+        return table;
+    }
+
+    Table table{{stmt_syn_1, stmt_syn_2}};
+
+    // Only enumerate the statements actually reachable from each source
+    for (const auto& stmt1 : relevant_stmts_1) {
+        for (const auto& stmt2 : read_facade->get_next_star_of(stmt1)) {
+            if (relevant_stmts_2.find(stmt2) != relevant_stmts_2.end()) {
+                table.add_row({stmt1, stmt2});
+            }
+        }
+    }
+
+    return table;
+}
+
+auto NextTEvaluator::eval_next_t(const Integer& stmt_num_1, const Integer& stmt_num_2) const -> OutputTable {
+    bool has_transitive = read_facade->has_next_star_index()
+                              ? read_facade->has_next_star_relation(stmt_num_1.value, stmt_num_2.value)
+                              : has_transitive_rs(stmt_num_1.value, {stmt_num_2.value}, next_of());
 
     if (has_transitive) {
         return UnitTable{};
@@ -145,6 +211,47 @@ auto NextTEvaluator::eval_next_t(const WildCard&, const Integer& stmt_num_2) con
     return Table{};
 }
 
+auto NextTEvaluator::reaches_any(const std::string& stmt, const std::unordered_set<std::string>& targets) const
+    -> bool {
+    const auto next_stmts = read_facade->get_next_star_of(stmt);
+    return std::any_of(next_stmts.begin(), next_stmts.end(), [&targets](const auto& next_stmt) {
+        return targets.find(next_stmt) != targets.end();
+    });
+}
+
+auto NextTEvaluator::has_witness() const -> bool {
+    const auto* stmt_syn_1 = std::get_if<std::shared_ptr<StmtSynonym>>(&next_t.stmt1);
+    const auto* stmt_syn_2 = std::get_if<std::shared_ptr<StmtSynonym>>(&next_t.stmt2);
+    const auto is_wildcard_1 = std::holds_alternative<WildCard>(next_t.stmt1);
+    const auto is_wildcard_2 = std::holds_alternative<WildCard>(next_t.stmt2);
+
+    if (stmt_syn_1 != nullptr && is_wildcard_2) {
+        const auto relevant_stmts = get_data(*stmt_syn_1);
+        return std::any_of(relevant_stmts.begin(), relevant_stmts.end(), [this](const auto& stmt) {
+            return read_facade->contains_next_key(stmt);
+        });
+    } else if (is_wildcard_1 && stmt_syn_2 != nullptr) {
+        const auto relevant_stmts = get_data(*stmt_syn_2);
+        return std::any_of(relevant_stmts.begin(), relevant_stmts.end(), [this](const auto& stmt) {
+            return read_facade->contains_next_value(stmt);
+        });
+    } else if (stmt_syn_1 == nullptr || stmt_syn_2 == nullptr || !read_facade->has_next_star_index()) {
+        return !is_empty(evaluate_positive());
+    }
+
+    const auto relevant_stmts_1 = get_data(*stmt_syn_1);
+    if (*stmt_syn_1 == *stmt_syn_2) {
+        return std::any_of(relevant_stmts_1.begin(), relevant_stmts_1.end(), [this](const auto& stmt) {
+            return read_facade->has_next_star_relation(stmt, stmt);
+        });
+    }
+
+    const auto relevant_stmts_2 = get_data(*stmt_syn_2);
+    return std::any_of(relevant_stmts_1.begin(), relevant_stmts_1.end(), [this, &relevant_stmts_2](const auto& stmt) {
+        return read_facade->contains_next_key(stmt) && reaches_any(stmt, relevant_stmts_2);
+    });
+}
+
 auto NextTEvaluator::eval_next_t(const WildCard&, const WildCard&) const -> OutputTable {
     if (read_facade->has_next_relation()) {
         return UnitTable{};
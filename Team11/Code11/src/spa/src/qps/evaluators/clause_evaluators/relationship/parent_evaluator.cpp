@@ -1,5 +1,8 @@
 #include "qps/evaluators/clause_evaluators/relationship/parent_evaluator.hpp"
 
+#include <array>
+#include <string>
+
 namespace qps {
 
 auto ParentEvaluator::select_eval_method() const {
@@ -21,6 +24,18 @@ auto ParentEvaluator::eval_parent(const std::shared_ptr<StmtSynonym>& stmt_syn_1
     const auto relevant_stmts_2 = get_data(stmt_syn_2);
 
     auto table = Table{{stmt_syn_1, stmt_syn_2}};
+    if (choose_access_path(relevant_stmts_1, relevant_stmts_2, RelationshipType::Parent) == AccessPath::Probe) {
+        probe(
+            table, relevant_stmts_1, relevant_stmts_2,
+            [this](const std::string& stmt) {
+                return read_facade->get_children_of(stmt);
+            },
+            [this](const std::string& stmt) {
+                return std::array<std::string, 1>{read_facade->get_parent_of(stmt)};
+            });
+        return table;
+    }
+
     // TODO: Improve pkb API: Get all parent-child pairs
     const auto parents_map = read_facade->get_all_parent();
     for (const auto& parent_child_set : parents_map) {
@@ -22,6 +22,18 @@ auto ParentTEvaluator::eval_parent_t(const std::shared_ptr<StmtSynonym>& stmt_sy
     const auto relevant_stmts_2 = get_data(stmt_syn_2);
 
     auto table = Table{{stmt_syn_1, stmt_syn_2}};
+    if (choose_access_path(relevant_stmts_1, relevant_stmts_2, RelationshipType::ParentStar) == AccessPath::Probe) {
+        probe(
+            table, relevant_stmts_1, relevant_stmts_2,
+            [this](const std::string& stmt) {
+                return read_facade->view_children_star_of(stmt);
+            },
+            [this](const std::string& stmt) {
+                return read_facade->view_parent_star_of(stmt);
+            });
+        return table;
+    }
+
     // TODO: Improve pkb API: Get all parent-star-child pairs
     const auto parents_map = read_facade->get_all_parent_star();
     for (const auto& parent_child_set : parents_map) {
@@ -44,7 +56,7 @@ auto ParentTEvaluator::eval_parent_t(const std::shared_ptr<StmtSynonym>& stmt_sy
     -> OutputTable {
     const auto relevant_stmts = get_data(stmt_syn_1);
     auto table = Table{{stmt_syn_1}};
-    const auto ancestors = read_facade->get_parent_star_of(stmt_num_2.value);
+    const auto ancestors = read_facade->view_parent_star_of(stmt_num_2.value);
     for (const auto& ancestor : ancestors) {
         if (relevant_stmts.find(ancestor) == relevant_stmts.end()) {
             continue;
@@ -72,7 +84,7 @@ auto ParentTEvaluator::eval_parent_t(const Integer& stmt_num_1, const std::share
     -> OutputTable {
     const auto relevant_stmts = get_data(stmt_syn_2);
     auto table = Table({stmt_syn_2});
-    const auto all_descendants_of_stmt = read_facade->get_children_star_of(stmt_num_1.value);
+    const auto all_descendants_of_stmt = read_facade->view_children_star_of(stmt_num_1.value);
     for (const auto& descendant : all_descendants_of_stmt) {
         if (relevant_stmts.find(descendant) == relevant_stmts.end()) {
             continue;
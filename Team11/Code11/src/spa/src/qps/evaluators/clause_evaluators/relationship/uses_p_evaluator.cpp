@@ -16,13 +16,32 @@ auto UsesPEvaluator::evaluate_positive() const -> OutputTable {
 
 auto UsesPEvaluator::eval_uses_p(const std::shared_ptr<ProcSynonym>& proc_synonym,
                                  const std::shared_ptr<VarSynonym>& var_synonym) const -> OutputTable {
+    const auto relevant_procs = get_data(proc_synonym);
+    const auto relevant_variables = get_data(var_synonym);
+
     auto table = Table{{proc_synonym, var_synonym}};
-    const auto all_proc_var_use_pairs = read_facade->get_all_procedures_and_var_use_pairs();
+    if (choose_access_path(relevant_procs, relevant_variables, RelationshipType::UsesP) == AccessPath::Probe) {
+        probe(
+            table, relevant_procs, relevant_variables,
+            [this](const std::string& proc) {
+                return read_facade->get_vars_used_by_procedure(proc);
+            },
+            [this](const std::string& var) {
+                return read_facade->get_procedures_that_use_var(var);
+            });
+        return table;
+    }
 
-    for (const auto& pair : all_proc_var_use_pairs) {
-        const auto proc = std::get<0>(pair);
-        const auto var_used = std::get<1>(pair);
-        table.add_row({proc, var_used});
+    const auto all_pairs = read_facade->get_all_procedures_and_var_use_pairs();
+    for (const auto& pair : all_pairs) {
+        const auto& [proc, var] = pair;
+        if (relevant_procs.find(proc) == relevant_procs.end()) {
+            continue;
+        }
+        if (relevant_variables.find(var) == relevant_variables.end()) {
+            continue;
+        }
+        table.add_row({proc, var});
     }
     return table;
 }
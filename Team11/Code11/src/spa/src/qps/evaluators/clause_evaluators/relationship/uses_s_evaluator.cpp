@@ -16,16 +16,32 @@ auto UsesSEvaluator::evaluate_positive() const -> OutputTable {
 
 auto UsesSEvaluator::eval_uses_s(const std::shared_ptr<StmtSynonym>& stmt_synonym,
                                  const std::shared_ptr<VarSynonym>& var_synonym) const -> OutputTable {
-    auto table = Table{{stmt_synonym, var_synonym}};
     const auto relevant_stmts = get_data(stmt_synonym);
+    const auto relevant_variables = get_data(var_synonym);
 
-    const auto all_stmt_var_use_pairs = read_facade->get_all_statements_and_var_use_pairs();
-    for (const auto& pair : all_stmt_var_use_pairs) {
-        const auto stmt_candidate = std::get<0>(pair);
-        const auto var_candidate = std::get<1>(pair);
-        if (relevant_stmts.find(stmt_candidate) != relevant_stmts.end()) {
-            table.add_row({stmt_candidate, var_candidate});
+    auto table = Table{{stmt_synonym, var_synonym}};
+    if (choose_access_path(relevant_stmts, relevant_variables, RelationshipType::UsesS) == AccessPath::Probe) {
+        probe(
+            table, relevant_stmts, relevant_variables,
+            [this](const std::string& stmt) {
+                return read_facade->get_vars_used_by_statement(stmt);
+            },
+            [this](const std::string& var) {
+                return read_facade->get_statements_that_use_var(var);
+            });
+        return table;
+    }
+
+    const auto all_pairs = read_facade->get_all_statements_and_var_use_pairs();
+    for (const auto& pair : all_pairs) {
+        const auto& [stmt, var] = pair;
+        if (relevant_stmts.find(stmt) == relevant_stmts.end()) {
+            continue;
+        }
+        if (relevant_variables.find(var) == relevant_variables.end()) {
+            continue;
         }
+        table.add_row({stmt, var});
     }
     return table;
 }
@@ -1,6 +1,10 @@
 #include "qps/evaluators/clause_evaluators/with_evaluator.hpp"
 #include "qps/evaluators/results_table.hpp"
 
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 namespace qps {
 auto WithEvaluator::select_eval_method() const {
     return overloaded{[this](auto&& arg1, auto&& arg2) -> OutputTable {
@@ -30,10 +34,30 @@ auto WithEvaluator::eval_with(const AttrRef& attr_1, const AttrRef& attr_2) cons
     const auto values_set_1 = get_data(attr_1.synonym);
     const auto values_set_2 = get_data(attr_2.synonym);
 
-    for (const auto& val_1 : values_set_1) {
-        for (const auto& val_2 : values_set_2) {
-            if (extractor_1(val_1) == extractor_2(val_2)) {
-                table.add_row({val_1, val_2});
+    // Hash join on the attribute: bucket the smaller side by its attribute value, then look up each value of the
+    // other side, so each attribute is extracted once per value
+    const auto is_build_1 = values_set_1.size() <= values_set_2.size();
+    const auto& build_values = is_build_1 ? values_set_1 : values_set_2;
+    const auto& probe_values = is_build_1 ? values_set_2 : values_set_1;
+    const auto& build_extractor = is_build_1 ? extractor_1 : extractor_2;
+    const auto& probe_extractor = is_build_1 ? extractor_2 : extractor_1;
+
+    auto buckets = std::unordered_map<std::string, std::vector<std::string>>{};
+    buckets.reserve(build_values.size());
+    for (const auto& val : build_values) {
+        buckets[build_extractor(val)].push_back(val);
+    }
+
+    for (const auto& val : probe_values) {
+        const auto it = buckets.find(probe_extractor(val));
+        if (it == buckets.end()) {
+            continue;
+        }
+        for (const auto& match : it->second) {
+            if (is_build_1) {
+                table.add_row({match, val});
+            } else {
+                table.add_row({val, match});
             }
         }
     }
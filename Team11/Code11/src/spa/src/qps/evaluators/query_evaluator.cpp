@@ -3,20 +3,82 @@
 #include "qps/evaluators/clause_evaluators/such_that_clause_evaluator_selector.hpp"
 #include "qps/evaluators/clause_evaluators/with_evaluator.hpp"
 #include "qps/evaluators/results_table.hpp"
+#include "qps/evaluators/value_dictionary.hpp"
 #include "qps/optimisers/default.hpp"
+#include "qps/optimisers/grouping.hpp"
 #include "qps/parser/analysers/semantic_analyser.hpp"
+#include "qps/template_utils.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <variant>
 #include <vector>
 
+namespace qps::detail {
+auto plan_columns(const Query& query_obj) -> ColumnPlan {
+    auto clause_synonyms = std::vector<Synonyms>{};
+    clause_synonyms.reserve(query_obj.clauses.size());
+    auto num_uses = std::unordered_map<std::string, int>{};
+    auto last_uses = std::unordered_map<std::string, std::size_t>{};
+    for (std::size_t i = 0; i < query_obj.clauses.size(); i++) {
+        auto synonyms = Synonyms{};
+        for (const auto& synonym : get_synonyms(query_obj.clauses[i])) {
+            if (std::find(synonyms.begin(), synonyms.end(), synonym) == synonyms.end()) {
+                synonyms.push_back(synonym);
+                num_uses[synonym->get_name_string()]++;
+                last_uses[synonym->get_name_string()] = i;
+            }
+        }
+        clause_synonyms.push_back(std::move(synonyms));
+    }
+
+    auto selected = std::unordered_set<std::string>{};
+    if (const auto* elems = std::get_if<std::vector<Elem>>(&query_obj.reference)) {
+        const auto to_synonym = overloaded{[](const std::shared_ptr<Synonym>& synonym) -> std::shared_ptr<Synonym> {
+                                               return synonym;
+                                           },
+                                           [](const AttrRef& attr_ref) -> std::shared_ptr<Synonym> {
+                                               return attr_ref.synonym;
+                                           }};
+        for (const auto& elem : *elems) {
+            selected.insert(std::visit(to_synonym, elem)->get_name_string());
+        }
+    }
+
+    auto plan = ColumnPlan{std::vector<ClauseDemand>(query_obj.clauses.size()),
+                           std::vector<Synonyms>(query_obj.clauses.size())};
+    for (std::size_t i = 0; i < query_obj.clauses.size(); i++) {
+        const auto is_negated = query_obj.clauses[i]->is_negated_clause();
+        auto& demand = plan.demands[i];
+        for (const auto& synonym : clause_synonyms[i]) {
+            const auto name = synonym->get_name_string();
+            if (selected.find(name) != selected.end() || last_uses[name] != i) {
+                continue;
+            }
+            plan.dead_after[i].push_back(synonym);
+            if (!is_negated && num_uses[name] == 1) {
+                demand.unneeded.push_back(synonym);
+            }
+        }
+        demand.is_existence_only = !is_negated && demand.unneeded.size() == clause_synonyms[i].size();
+    }
+    return plan;
+}
+} // namespace qps::detail
+
 namespace qps {
 auto QueryEvaluator::optimise(const Query& query_obj) const -> std::vector<Query> {
     const auto queries = std::vector<Query>{query_obj};
     return optimiser->optimise(queries);
 }
 
-auto QueryEvaluator::evaluate_query(const Query& query_obj) -> OutputTable {
+auto QueryEvaluator::evaluate_query(const Query& query_obj, const std::atomic<bool>& cancelled) const -> OutputTable {
+    // Groups may be evaluated on different threads, so each encodes its values with a dictionary of its own
+    const auto scope = ValueDictionary::Scope{std::make_shared<ValueDictionary>()};
     const auto reference = query_obj.reference;
 
     auto curr_table = OutputTable{UnitTable{}};
@@ -27,18 +89,23 @@ auto QueryEvaluator::evaluate_query(const Query& query_obj) -> OutputTable {
     }
 
     // Step 1: populate all synonyms
-    for (const auto& clause : query_obj.clauses) {
+    const auto plan = detail::plan_columns(query_obj);
+    for (std::size_t i = 0; i < query_obj.clauses.size(); i++) {
+        const auto& clause = query_obj.clauses[i];
+        if (cancelled) {
+            return OutputTable{Table{}};
+        }
+
         const auto data_source = DataSource{read_facade, curr_table};
+        auto evaluator = std::shared_ptr<ClauseEvaluator>{};
         if (const auto such_that_clause = std::dynamic_pointer_cast<qps::SuchThatClause>(clause)) {
             const auto relationship = such_that_clause->rel_ref;
-            evaluator = std::visit(such_that_clause_evaluator_selector(data_source, read_facade, false), relationship);
+            evaluator = std::visit(such_that_clause_evaluator_selector(data_source, read_facade), relationship);
         } else if (const auto pattern_clause = std::dynamic_pointer_cast<qps::PatternClause>(clause)) {
             const auto syntactic_pattern = pattern_clause->syntactic_pattern;
-            evaluator =
-                std::visit(pattern_clause_evaluator_selector(data_source, read_facade, false), syntactic_pattern);
+            evaluator = std::visit(pattern_clause_evaluator_selector(data_source, read_facade), syntactic_pattern);
         } else if (const auto with_clause = std::dynamic_pointer_cast<qps::WithClause>(clause)) {
-            evaluator =
-                std::make_shared<WithEvaluator>(data_source, read_facade, with_clause->ref1, with_clause->ref2, false);
+            evaluator = std::make_shared<WithEvaluator>(data_source, read_facade, with_clause->ref1, with_clause->ref2);
         }
 
         if (evaluator == nullptr) {
@@ -49,13 +116,16 @@ auto QueryEvaluator::evaluate_query(const Query& query_obj) -> OutputTable {
             return project_to_table(read_facade, empty_table, reference);
         }
 
+        evaluator->set_demand(plan.demands[i]);
         auto next_table = evaluator->evaluate();
+        if (const auto choice = evaluator->get_access_path_choice(); trace != nullptr && choice.has_value()) {
+            trace->record(clause->representation(), *choice);
+        }
 
         if (clause->is_negated_clause()) {
-            if (is_empty(next_table)) {
-                continue;
+            if (!is_empty(next_table)) {
+                curr_table = subtract(std::move(curr_table), std::move(next_table), read_facade);
             }
-            curr_table = subtract(std::move(curr_table), std::move(next_table), read_facade);
         } else {
             if (is_empty(next_table)) {
 #ifdef DEBUG
@@ -71,12 +141,50 @@ auto QueryEvaluator::evaluate_query(const Query& query_obj) -> OutputTable {
 #endif
             return project_to_table(read_facade, curr_table, reference);
         }
+
+        // Keep intermediate tables to the synonyms later clauses or the reference still need
+        curr_table = drop_columns(std::move(curr_table), plan.dead_after[i]);
     }
 
     return project_to_table(read_facade, curr_table, reference);
 }
 
+auto QueryEvaluator::evaluate_groups(const std::vector<Query>& queries) const -> std::vector<OutputTable> {
+    auto cancelled = std::atomic<bool>{false};
+    auto tables = std::vector<OutputTable>{};
+
+    if (thread_pool == nullptr || queries.size() < 2) {
+        for (const auto& query : queries) {
+            tables.push_back(evaluate_query(query, cancelled));
+            if (is_empty(tables.back())) {
+                break;
+            }
+        }
+        return tables;
+    }
+
+    // Workers claim the next group as soon as they are free, so the query takes about as long as its slowest group
+    tables.resize(queries.size(), OutputTable{UnitTable{}});
+    thread_pool->parallel_for(queries.size(), [this, &queries, &tables, &cancelled](std::size_t index, std::size_t) {
+        if (cancelled) {
+            return;
+        }
+        tables[index] = evaluate_query(queries[index], cancelled);
+        if (is_empty(tables[index])) {
+            cancelled = true;
+        }
+    });
+
+    if (cancelled) {
+        return {OutputTable{Table{}}};
+    }
+    return tables;
+}
+
 auto QueryEvaluator::evaluate(const qps::Query& query_obj) -> std::vector<std::string> {
+    // The values of the query are only kept as long as its tables
+    const auto scope = ValueDictionary::Scope{std::make_shared<ValueDictionary>()};
+
     // Step 1: optimise query
     const auto optimised_queries = optimise(query_obj);
     if (has_contradiction(optimised_queries)) {
@@ -86,8 +194,7 @@ auto QueryEvaluator::evaluate(const qps::Query& query_obj) -> std::vector<std::s
 
     // Step 2: evaluate optimised queries
     auto curr_table = OutputTable{UnitTable{}};
-    for (const auto& query : optimised_queries) {
-        auto next_table = evaluate_query(query);
+    for (auto& next_table : evaluate_groups(optimised_queries)) {
         if (is_empty(next_table)) {
             return project(read_facade, next_table, query_obj.reference);
         }
@@ -98,8 +205,8 @@ auto QueryEvaluator::evaluate(const qps::Query& query_obj) -> std::vector<std::s
         }
     }
 
-    // Step 2: project to relevant synonym
+    // Step 3: project to relevant synonym
     return project(read_facade, curr_table, query_obj.reference);
 }
 
-} // namespace qps
\ No newline at end of file
+} // namespace qps
@@ -0,0 +1,24 @@
+#include "qps/evaluators/query_trace.hpp"
+
+#include <utility>
+
+namespace qps {
+auto operator<<(std::ostream& os, AccessPath access_path) -> std::ostream& {
+    return os << (access_path == AccessPath::Probe ? "probe" : "scan");
+}
+
+auto QueryTrace::record(std::string clause, AccessPathChoice choice) -> void {
+    const auto lock = std::lock_guard{mutex};
+    entries.push_back({std::move(clause), choice});
+}
+
+auto QueryTrace::get_entries() const -> std::vector<Entry> {
+    const auto lock = std::lock_guard{mutex};
+    return entries;
+}
+
+auto QueryTrace::clear() -> void {
+    const auto lock = std::lock_guard{mutex};
+    entries.clear();
+}
+} // namespace qps
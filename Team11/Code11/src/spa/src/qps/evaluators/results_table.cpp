@@ -6,6 +6,8 @@
 #include "qps/template_utils.hpp"
 
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <iterator>
 #include <memory>
 #include <numeric>
@@ -49,15 +51,83 @@ static auto get_mapping_from_synonyms_to_table_names(const Synonyms& table_colum
     return new_idx_to_old_idx;
 }
 
-auto compare_rows(const std::vector<std::string>& row1, const std::vector<std::string>& row2,
-                  const std::vector<int>& idxs) -> bool {
-    for (auto idx : idxs) {
-        const auto compareResult = row1[idx].compare(row2[idx]);
-        if (compareResult != 0) {
-            return compareResult < 0; // Sort by the i-th column
+/**
+ * @brief Compare a row of table1 against a row of table2 on the given pairs of columns.
+ *
+ * @return int Negative, zero or positive as the row of table1 orders before, equal to or after the row of table2
+ */
+static auto compare_on_columns(const Table& table1, std::size_t row1, const Table& table2, std::size_t row2,
+                               const std::vector<std::tuple<int, int>>& column_idxs) -> int {
+    for (auto [idx1, idx2] : column_idxs) {
+        const auto value1 = table1.get_column_ids(idx1)[row1];
+        const auto value2 = table2.get_column_ids(idx2)[row2];
+        if (value1 != value2) {
+            return value1 < value2 ? -1 : 1;
         }
     }
-    return false; // If all first n columns are equal, don't change the order
+    return 0;
+}
+
+static auto hash_on_columns(const Table& table, std::size_t row, const std::vector<int>& idxs) -> std::size_t {
+    auto seed = std::size_t{0};
+    for (auto idx : idxs) {
+        std::hash_combine(seed, table.get_column_ids(idx)[row]);
+    }
+    return seed;
+}
+
+static auto to_column_names(const Table& table, const std::vector<int>& idxs) -> std::vector<std::shared_ptr<Synonym>> {
+    const auto column_names = table.get_column();
+    auto names = std::vector<std::shared_ptr<Synonym>>{};
+    names.reserve(idxs.size());
+    for (auto idx : idxs) {
+        names.push_back(column_names[idx]);
+    }
+    return names;
+}
+
+static auto split_common_column_idxs(const std::vector<std::tuple<int, int>>& common_column_idxs)
+    -> std::tuple<std::vector<int>, std::vector<int>> {
+    auto first_idxs = std::vector<int>{};
+    first_idxs.reserve(common_column_idxs.size());
+    auto second_idxs = std::vector<int>{};
+    second_idxs.reserve(common_column_idxs.size());
+
+    for (auto [idx1, idx2] : common_column_idxs) {
+        first_idxs.push_back(idx1);
+        second_idxs.push_back(idx2);
+    }
+    return std::make_tuple(first_idxs, second_idxs);
+}
+
+/**
+ * @brief Sort the row indices of a table on the given columns, leaving the columns themselves untouched.
+ * Tables that are already sorted on these columns keep their row order.
+ */
+static auto sort_rows_on_columns(const Table& table, const std::vector<int>& idxs) -> std::vector<std::size_t> {
+    auto rows = std::vector<std::size_t>(table.size());
+    std::iota(rows.begin(), rows.end(), 0);
+    if (table.is_sorted_on(to_column_names(table, idxs))) {
+        return rows;
+    }
+
+    std::sort(rows.begin(), rows.end(), [&table, &idxs](std::size_t row1, std::size_t row2) {
+        for (auto idx : idxs) {
+            const auto& values = table.get_column_ids(idx);
+            if (values[row1] != values[row2]) {
+                return values[row1] < values[row2];
+            }
+        }
+        return false;
+    });
+    return rows;
+}
+
+static auto sort_rows_on_common_columns(const Table& table1, const Table& table2,
+                                        const std::vector<std::tuple<int, int>>& common_column_idxs)
+    -> std::tuple<std::vector<std::size_t>, std::vector<std::size_t>> {
+    const auto [first_idxs, second_idxs] = split_common_column_idxs(common_column_idxs);
+    return std::make_tuple(sort_rows_on_columns(table1, first_idxs), sort_rows_on_columns(table2, second_idxs));
 }
 
 static void print(const std::vector<std::vector<std::string>>& records) {
@@ -185,29 +255,6 @@ static auto double_pointer_merge_with_ordering(std::vector<std::shared_ptr<Synon
     return std::make_tuple(new_column, ordering1, ordering2, common_column_idxs);
 }
 
-/**
- * @brief Build an index mapping from old_column to new_column.
- *
- * This function does not assume that the columns are sorted.
- *
- * @param old_column Column names from the old table
- * @param new_column Column names from the new table
- * @return std::unordered_map<int, int> Index mapping from old_column to new_column
- */
-static auto build_mapping(const std::vector<std::shared_ptr<Synonym>>& old_column,
-                          const std::vector<std::shared_ptr<Synonym>>& new_column) -> std::unordered_map<int, int> {
-    auto mapping = std::unordered_map<int, int>{};
-    mapping.reserve(old_column.size());
-    for (int i = 0; i < static_cast<int>(old_column.size()); i++) {
-        for (int j = 0; j < static_cast<int>(new_column.size()); j++) {
-            if (old_column[i] == new_column[j]) {
-                mapping[i] = j;
-            }
-        }
-    }
-    return mapping;
-}
-
 /**
  * @brief Build an index mapping from old_column to new_column.
  * This function assumes that the columns are sorted.
@@ -239,186 +286,147 @@ static auto build_mapping_sorted(const std::vector<std::shared_ptr<Synonym>>& ol
     return mapping;
 }
 
-static void nested_loop_join_records(const Table& table1, const Table& table2, Table& new_table) {
-    const auto column1 = table1.get_column();
-    const auto column2 = table2.get_column();
-    const auto new_column = new_table.get_column();
-
-    const auto table1_mask = build_mapping(column1, new_column);
-    const auto table2_mask = build_mapping(column2, new_column);
-
-    for (const auto& record1 : table1.get_records()) {
-        for (const auto& record2 : table2.get_records()) {
-            auto new_record = std::vector<std::string>(new_column.size(), "");
-            auto has_conflict = false;
-
-            // Populate new_record with values from record1
-            for (int i = 0; i < static_cast<int>(record1.size()); i++) {
-                if (table1_mask.find(i) == table1_mask.end()) {
-                    continue;
-                }
-                new_record[table1_mask.at(i)] = record1[i];
+/**
+ * @brief Build a table from row indices into two tables, where the i-th output row combines rows1[i] and rows2[i].
+ * Common columns are taken from table1.
+ */
+static auto gather_join(const Table& table1, const Table& table2, const std::vector<std::size_t>& rows1,
+                        const std::vector<std::size_t>& rows2, const std::unordered_map<int, int>& table1_mask,
+                        const std::unordered_map<int, int>& table2_mask,
+                        const std::vector<std::shared_ptr<Synonym>>& new_column_names) -> Table {
+    auto new_columns = std::vector<std::vector<ValueId>>(new_column_names.size());
+    auto is_filled = std::vector<bool>(new_column_names.size(), false);
+
+    const auto gather = [&new_columns, &is_filled](const Table& table, const std::vector<std::size_t>& rows,
+                                                   const std::unordered_map<int, int>& mask) {
+        for (const auto& [old_idx, new_idx] : mask) {
+            if (is_filled[new_idx]) {
+                continue;
             }
+            is_filled[new_idx] = true;
 
-            // Populate new_record with values from record2, checking for conflicts
-            for (int i = 0; i < static_cast<int>(record2.size()); i++) {
-                if (table2_mask.find(i) == table2_mask.end()) {
-                    continue;
-                }
-                if (!new_record[table2_mask.at(i)].empty() && new_record[table2_mask.at(i)] != record2[i]) {
-                    // Conflict detected
-                    has_conflict = true;
-                    break;
-                }
-                new_record[table2_mask.at(i)] = record2[i];
+            const auto& values = table.get_column_ids(old_idx);
+            auto& new_values = new_columns[new_idx];
+            new_values.reserve(rows.size());
+            for (auto row : rows) {
+                new_values.push_back(values[row]);
             }
-
-            if (has_conflict) {
-                // Skip this record if there is a conflict
-                continue;
-            }
-            new_table.add_row(new_record);
         }
-    }
-}
-
-template <typename ColumnMergeStrategy, typename JoinRecordsStrategy>
-static auto join(Table&& table1, Table&& table2, ColumnMergeStrategy column_merge_strategy,
-                 JoinRecordsStrategy join_records_strategy) -> Table {
-    // Step 0: Short-circuit if either table is empty
-    if (table1.empty()) {
-        return table2;
-    } else if (table2.empty()) {
-        return table1;
-    }
-
-    // Step 1: join columns
-    const auto new_column = column_merge_strategy(table1.get_column(), table2.get_column());
-    auto new_table = Table{new_column};
+    };
+    gather(table1, rows1, table1_mask);
+    gather(table2, rows2, table2_mask);
 
-    // Step 2: join records
-    join_records_strategy(table1, table2, new_table);
-
-    return new_table;
+    return Table{new_column_names, std::move(new_columns), table1.get_dictionary()};
 }
 
-static auto sort_on_column(std::vector<std::vector<std::string>>& table1_contents,
-                           std::vector<std::vector<std::string>>& table2_contents,
-                           const std::vector<std::tuple<int, int>>& common_column_idxs) -> void {
-    auto first_idxs = std::vector<int>{};
-    first_idxs.reserve(common_column_idxs.size());
-    auto second_idxs = std::vector<int>{};
-    second_idxs.reserve(common_column_idxs.size());
-
-    for (auto [idx1, idx2] : common_column_idxs) {
-        first_idxs.push_back(idx1);
-        second_idxs.push_back(idx2);
+/**
+ * @brief Build a table from the given rows of a table, keeping its columns. The rows must be in increasing order.
+ */
+static auto gather_rows(const Table& table, const std::vector<std::size_t>& rows) -> Table {
+    const auto column_names = table.get_column();
+    auto new_columns = std::vector<std::vector<ValueId>>(column_names.size());
+    for (int i = 0; i < static_cast<int>(column_names.size()); i++) {
+        const auto& values = table.get_column_ids(i);
+        new_columns[i].reserve(rows.size());
+        for (auto row : rows) {
+            new_columns[i].push_back(values[row]);
+        }
     }
 
-    std::sort(table1_contents.begin(), table1_contents.end(),
-              [&first_idxs](const auto& row1, const auto& row2) -> bool {
-                  return compare_rows(row1, row2, first_idxs);
-              });
-
-    std::sort(table2_contents.begin(), table2_contents.end(),
-              [&second_idxs](const auto& row1, const auto& row2) -> bool {
-                  return compare_rows(row1, row2, second_idxs);
-              });
-}
-
-static void reorder_contents(std::vector<std::vector<std::string>>& table_contents, const std::vector<int>& order) {
-    std::for_each(table_contents.begin(), table_contents.end(), [&order](auto& row) {
-        reorder(row, order);
-    });
+    auto new_table = Table{column_names, std::move(new_columns), table.get_dictionary()};
+    new_table.set_sort_key(table.get_sort_key());
+    return new_table;
 }
 
-static auto merge_join_impl(std::vector<std::vector<std::string>>&& table1_contents,
-                            std::vector<std::vector<std::string>>&& table2_contents,
-                            const std::unordered_map<int, int>& table1_mask,
-                            const std::unordered_map<int, int>& table2_mask,
+static auto merge_join_impl(const Table& table1, const Table& table2,
                             const std::vector<std::tuple<int, int>>& common_column_idxs,
                             const std::vector<std::shared_ptr<Synonym>>& new_column_names) -> OutputTable {
-    // Preconditions: table1_contents and table2_contents are sorted based on the common columns
-    auto new_table = Table{new_column_names};
+    // Preconditions: the columns of both tables are sorted, so that masks can be built by merging
+    const auto table1_mask = build_mapping_sorted(table1.get_column(), new_column_names);
+    const auto table2_mask = build_mapping_sorted(table2.get_column(), new_column_names);
+    const auto [rows1, rows2] = sort_rows_on_common_columns(table1, table2, common_column_idxs);
 
-    auto curr_row1 = table1_contents.begin();
-    auto curr_row2 = table2_contents.begin();
-    while (curr_row1 != table1_contents.end() && curr_row2 != table2_contents.end()) {
+    auto matched_rows1 = std::vector<std::size_t>{};
+    auto matched_rows2 = std::vector<std::size_t>{};
+
+    auto curr_row1 = std::size_t{0};
+    auto curr_row2 = std::size_t{0};
+    while (curr_row1 < rows1.size() && curr_row2 < rows2.size()) {
         // Shift row pointers to the first row with the same value in the common column
-        auto all_same = true;
-        for (auto [col_idx1, col_idx2] : common_column_idxs) {
-            if ((*curr_row1)[col_idx1] < (*curr_row2)[col_idx2]) {
-                curr_row1++;
-                all_same = false;
-                break;
-            } else if ((*curr_row1)[col_idx1] > (*curr_row2)[col_idx2]) {
-                curr_row2++;
-                all_same = false;
-                break;
-            }
-        }
-        if (!all_same) {
+        const auto order = compare_on_columns(table1, rows1[curr_row1], table2, rows2[curr_row2], common_column_idxs);
+        if (order < 0) {
+            curr_row1++;
+            continue;
+        } else if (order > 0) {
+            curr_row2++;
             continue;
         }
 
-        // Save right pointer
-        const auto right_ptr = curr_row2;
-
-        while (true) {
-            // All common columns are equal -> safe to join the records
-            auto new_record = std::vector<std::string>(new_column_names.size(), "");
-            // Populate new_record with values from records
-            for (int i = 0; i < static_cast<int>(curr_row1->size()); i++) {
-                new_record[table1_mask.at(i)] = (*curr_row1)[i];
-            }
-            for (int i = 0; i < static_cast<int>(curr_row2->size()); i++) {
-                new_record[table2_mask.at(i)] = (*curr_row2)[i];
-            }
-
-            new_table.add_row(new_record);
-
-            // Advance right pointer
-            curr_row2 = std::next(curr_row2);
-
-            // Stop if we have reached the end of the table
-            if (curr_row2 == table2_contents.end()) {
-                // Reset right pointer
-                curr_row2 = right_ptr;
-                break;
-            }
-
-            // Stop if the common columns are no longer equal
-            all_same = true;
-            for (auto [col_idx1, col_idx2] : common_column_idxs) {
-                if ((*curr_row1)[col_idx1] != (*curr_row2)[col_idx2]) {
-                    all_same = false;
-                    break;
-                }
-            }
-            if (!all_same) {
-                // Reset right pointer
-                curr_row2 = right_ptr;
-                break;
-            }
+        // All common columns are equal -> pair the row with the whole run of equal rows, keeping the right pointer
+        for (auto run_row2 = curr_row2;
+             run_row2 < rows2.size() &&
+             compare_on_columns(table1, rows1[curr_row1], table2, rows2[run_row2], common_column_idxs) == 0;
+             run_row2++) {
+            matched_rows1.push_back(rows1[curr_row1]);
+            matched_rows2.push_back(rows2[run_row2]);
         }
 
         // Move to the next row
         curr_row1++;
     }
 
+    // Rows come out in the order of table1's sorted rows
+    auto new_table =
+        gather_join(table1, table2, matched_rows1, matched_rows2, table1_mask, table2_mask, new_column_names);
+    new_table.set_sort_key(to_column_names(table1, std::get<0>(split_common_column_idxs(common_column_idxs))));
     return new_table;
 }
 
-static auto reorder_table_data(std::vector<std::vector<std::string>>& table1_contents,
-                               std::vector<std::vector<std::string>>& table2_contents,
-                               const std::vector<int>& ordering1, const std::vector<int>& ordering2,
-                               const std::vector<std::tuple<int, int>>& common_column_idxs) -> void {
-    // Reorder data
-    reorder_contents(table1_contents, ordering1);
-    reorder_contents(table2_contents, ordering2);
+static auto hash_join_impl(const Table& table1, const Table& table2,
+                           const std::vector<std::tuple<int, int>>& common_column_idxs,
+                           const std::vector<std::shared_ptr<Synonym>>& new_column_names) -> OutputTable {
+    // Preconditions: the columns of both tables are sorted, so that masks can be built by merging
+    const auto table1_mask = build_mapping_sorted(table1.get_column(), new_column_names);
+    const auto table2_mask = build_mapping_sorted(table2.get_column(), new_column_names);
+    const auto [idxs1, idxs2] = split_common_column_idxs(common_column_idxs);
+
+    // Build on the smaller table and probe with the larger one
+    const auto build_on_table1 = table1.size() <= table2.size();
+    const auto& build_table = build_on_table1 ? table1 : table2;
+    const auto& probe_table = build_on_table1 ? table2 : table1;
+    const auto& build_idxs = build_on_table1 ? idxs1 : idxs2;
+    const auto& probe_idxs = build_on_table1 ? idxs2 : idxs1;
+
+    auto buckets = std::unordered_map<std::size_t, std::vector<std::size_t>>{};
+    buckets.reserve(build_table.size());
+    for (std::size_t row = 0; row < build_table.size(); row++) {
+        buckets[hash_on_columns(build_table, row, build_idxs)].push_back(row);
+    }
+
+    auto matched_rows1 = std::vector<std::size_t>{};
+    auto matched_rows2 = std::vector<std::size_t>{};
+    for (std::size_t probe_row = 0; probe_row < probe_table.size(); probe_row++) {
+        const auto bucket = buckets.find(hash_on_columns(probe_table, probe_row, probe_idxs));
+        if (bucket == buckets.end()) {
+            continue;
+        }
+
+        // Rows in a bucket only share a hash, so the common columns still have to be compared
+        for (auto build_row : bucket->second) {
+            const auto row1 = build_on_table1 ? build_row : probe_row;
+            const auto row2 = build_on_table1 ? probe_row : build_row;
+            if (compare_on_columns(table1, row1, table2, row2, common_column_idxs) == 0) {
+                matched_rows1.push_back(row1);
+                matched_rows2.push_back(row2);
+            }
+        }
+    }
 
-    // Sort based on values in the common column
-    sort_on_column(table1_contents, table2_contents, common_column_idxs);
+    // Rows come out in the order of the probe table, so its sort order carries over
+    auto new_table =
+        gather_join(table1, table2, matched_rows1, matched_rows2, table1_mask, table2_mask, new_column_names);
+    new_table.set_sort_key(probe_table.get_sort_key());
+    return new_table;
 }
 
 auto merge_join(Table&& table1, Table&& table2) -> OutputTable {
@@ -428,18 +436,19 @@ auto merge_join(Table&& table1, Table&& table2) -> OutputTable {
     } else if (table2.empty()) {
         return table1;
     }
+    table2.use_dictionary(table1.get_dictionary());
 
     auto& tableA = table1.get_column().size() < table2.get_column().size() ? table1 : table2;
     auto& tableB = table1.get_column().size() < table2.get_column().size() ? table2 : table1;
 
+    auto table1_column_names = tableA.get_column();
+    auto table2_column_names = tableB.get_column();
     const auto& [new_column, ordering1, ordering2, common_column_idxs] =
-        double_pointer_merge_with_ordering(tableA.get_column(), tableB.get_column());
-    const auto table1_mask = build_mapping_sorted(tableA.get_column(), new_column);
-    const auto table2_mask = build_mapping_sorted(tableB.get_column(), new_column);
+        double_pointer_merge_with_ordering(table1_column_names, table2_column_names);
 
-    reorder_table_data(tableA.get_records(), tableB.get_records(), ordering1, ordering2, common_column_idxs);
-    return merge_join_impl(std::move(tableA.get_records()), std::move(tableB.get_records()), table1_mask, table2_mask,
-                           common_column_idxs, new_column);
+    tableA.reorder_columns(ordering1);
+    tableB.reorder_columns(ordering2);
+    return merge_join_impl(tableA, tableB, common_column_idxs, new_column);
 }
 
 auto cross_merge_join(Table&& table1, Table&& table2) -> OutputTable {
@@ -449,6 +458,7 @@ auto cross_merge_join(Table&& table1, Table&& table2) -> OutputTable {
     } else if (table2.empty()) {
         return table1;
     }
+    table2.use_dictionary(table1.get_dictionary());
 
     // Step 1: Reorder columns and rows
     auto& tableA = table1.get_column().size() < table2.get_column().size() ? table1 : table2;
@@ -463,15 +473,88 @@ auto cross_merge_join(Table&& table1, Table&& table2) -> OutputTable {
     if (common_column_idxs.empty()) {
         return cross_join(std::move(tableA), std::move(tableB));
     } else {
-        tableA.get_column() = std::move(table1_column_names);
-        tableB.get_column() = std::move(table2_column_names);
-        const auto table1_mask = build_mapping_sorted(tableA.get_column(), new_column);
-        const auto table2_mask = build_mapping_sorted(tableB.get_column(), new_column);
+        tableA.reorder_columns(ordering1);
+        tableB.reorder_columns(ordering2);
+        return merge_join_impl(tableA, tableB, common_column_idxs, new_column);
+    }
+}
+
+auto hash_join(Table&& table1, Table&& table2) -> OutputTable {
+    // Step 0: Short-circuit if either table is empty
+    if (table1.empty()) {
+        return table2;
+    } else if (table2.empty()) {
+        return table1;
+    }
+    table2.use_dictionary(table1.get_dictionary());
+
+    auto table1_column_names = table1.get_column();
+    auto table2_column_names = table2.get_column();
+    const auto& [new_column, ordering1, ordering2, common_column_idxs] =
+        double_pointer_merge_with_ordering(table1_column_names, table2_column_names);
+
+    if (common_column_idxs.empty()) {
+        return cross_join(std::move(table1), std::move(table2));
+    }
+
+    table1.reorder_columns(ordering1);
+    table2.reorder_columns(ordering2);
+    return hash_join_impl(table1, table2, common_column_idxs, new_column);
+}
+
+// Cost of hashing a row to build or probe a hash join, relative to comparing it once in a merge join
+static constexpr auto HASH_ROW_COST = 2.0;
+
+// Merge join sorts only the tables that are not sorted on the common columns yet
+static auto get_sort_cost(std::size_t num_rows, bool is_sorted) -> double {
+    const auto rows = static_cast<double>(num_rows);
+    return is_sorted ? 0.0 : rows * std::log2(rows + 1);
+}
+
+/**
+ * @brief Picks merge join when sorting the tables that are not sorted yet and merging them costs less than hashing
+ * both, e.g. when both are sorted, or when only the larger table is and the smaller one is cheap to sort; otherwise
+ * a hash join avoids sorting a large table.
+ */
+auto select_join_strategy(const Table& table1, const Table& table2) -> JoinStrategy {
+    if (table1.empty() || table2.empty()) {
+        return JoinStrategy::Cross;
+    }
+
+    // Common columns in the order they are compared by the joins
+    auto column_names1 = table1.get_column();
+    auto column_names2 = table2.get_column();
+    std::sort(column_names1.begin(), column_names1.end());
+    std::sort(column_names2.begin(), column_names2.end());
+    auto common_column_names = std::vector<std::shared_ptr<Synonym>>{};
+    std::set_intersection(column_names1.begin(), column_names1.end(), column_names2.begin(), column_names2.end(),
+                          std::back_inserter(common_column_names));
+
+    if (common_column_names.empty()) {
+        return JoinStrategy::Cross;
+    }
+
+    const auto num_rows1 = table1.size();
+    const auto num_rows2 = table2.size();
+    const auto merge_cost = get_sort_cost(num_rows1, table1.is_sorted_on(common_column_names)) +
+                            get_sort_cost(num_rows2, table2.is_sorted_on(common_column_names)) +
+                            static_cast<double>(num_rows1 + num_rows2);
+    const auto hash_cost = HASH_ROW_COST * static_cast<double>(num_rows1 + num_rows2);
+    return merge_cost <= hash_cost ? JoinStrategy::Merge : JoinStrategy::Hash;
+}
 
-        reorder_table_data(tableA.get_records(), tableB.get_records(), ordering1, ordering2, common_column_idxs);
-        return merge_join_impl(std::move(tableA.get_records()), std::move(tableB.get_records()), table1_mask,
-                               table2_mask, common_column_idxs, new_column);
+auto adaptive_join(Table&& table1, Table&& table2) -> OutputTable {
+    // Re-encoding forgets the sort order, so it must happen before the strategy is picked
+    table2.use_dictionary(table1.get_dictionary());
+    switch (select_join_strategy(table1, table2)) {
+    case JoinStrategy::Cross:
+        return cross_join(std::move(table1), std::move(table2));
+    case JoinStrategy::Merge:
+        return merge_join(std::move(table1), std::move(table2));
+    case JoinStrategy::Hash:
+        return hash_join(std::move(table1), std::move(table2));
     }
+    return cross_merge_join(std::move(table1), std::move(table2));
 }
 
 /**
@@ -488,43 +571,45 @@ auto cross_join(Table&& table1, Table&& table2) -> OutputTable {
     } else if (table2.empty()) {
         return table1;
     }
+    table2.use_dictionary(table1.get_dictionary());
 
-    // Step 1: Reorder columns and rows
-    auto& table1_contents = table1.get_records();
-    auto& table2_contents = table2.get_records();
-    auto& table1_column_names = table1.get_column();
-    auto& table2_column_names = table2.get_column();
-
-    auto new_column = [&table1_column_names, &table2_column_names]() {
-        std::vector<std::shared_ptr<Synonym>> new_column{};
-        new_column.reserve(table1_column_names.size() + table2_column_names.size());
-        new_column.insert(new_column.end(), std::make_move_iterator(table1_column_names.begin()),
-                          std::make_move_iterator(table1_column_names.end()));
-        new_column.insert(new_column.end(), std::make_move_iterator(table2_column_names.begin()),
-                          std::make_move_iterator(table2_column_names.end()));
-        return new_column;
-    }();
-
-    auto new_table = Table{new_column};
-
-    // Step 2: join records
-    for (const auto& record1 : table1_contents) {
-        for (const auto& record2 : table2_contents) {
-            auto new_record = std::vector<std::string>{};
-            new_record.reserve(new_column.size());
-            new_record.insert(new_record.end(), record1.begin(), record1.end());
-            new_record.insert(new_record.end(), record2.begin(), record2.end());
-            new_table.add_row(new_record);
+    // Step 1: join columns
+    const auto table1_column_names = table1.get_column();
+    const auto table2_column_names = table2.get_column();
+
+    auto new_column = std::vector<std::shared_ptr<Synonym>>{};
+    new_column.reserve(table1_column_names.size() + table2_column_names.size());
+    new_column.insert(new_column.end(), table1_column_names.begin(), table1_column_names.end());
+    new_column.insert(new_column.end(), table2_column_names.begin(), table2_column_names.end());
+
+    // Step 2: join records, repeating each value of table1 and tiling the columns of table2
+    const auto num_rows1 = table1.size();
+    const auto num_rows2 = table2.size();
+    auto new_columns = std::vector<std::vector<ValueId>>{};
+    new_columns.reserve(new_column.size());
+
+    for (int i = 0; i < static_cast<int>(table1_column_names.size()); i++) {
+        auto& new_values = new_columns.emplace_back();
+        new_values.reserve(num_rows1 * num_rows2);
+        for (auto value : table1.get_column_ids(i)) {
+            new_values.insert(new_values.end(), num_rows2, value);
+        }
+    }
+    for (int i = 0; i < static_cast<int>(table2_column_names.size()); i++) {
+        const auto& values = table2.get_column_ids(i);
+        auto& new_values = new_columns.emplace_back();
+        new_values.reserve(num_rows1 * num_rows2);
+        for (std::size_t row1 = 0; row1 < num_rows1; row1++) {
+            new_values.insert(new_values.end(), values.begin(), values.end());
         }
     }
 
+    // Each row of table1 is repeated in place, so its sort order carries over
+    auto new_table = Table{std::move(new_column), std::move(new_columns), table1.get_dictionary()};
+    new_table.set_sort_key(table1.get_sort_key());
     return new_table;
 }
 
-auto cross_join_with_conflict_checks(Table&& table1, Table&& table2) -> OutputTable {
-    return join(std::move(table1), std::move(table2), double_pointer_merge, nested_loop_join_records);
-}
-
 /**
  * @brief Build full synonym table from the given elements
  *
@@ -543,56 +628,44 @@ static auto build_full_table(const Synonyms& synonyms, const std::shared_ptr<pkb
 
 static auto reorder_table(Table& table, const Synonyms& requested_synonyms) -> void {
     const auto& new_idx_to_old_idx = get_mapping_from_synonyms_to_table_names(table.get_column(), requested_synonyms);
-    reorder(table.get_column(), new_idx_to_old_idx);
-    for (auto& row : table.get_records()) {
-        reorder(row, new_idx_to_old_idx);
-    }
+    table.reorder_columns(new_idx_to_old_idx);
 }
 
-static auto subtract_impl(std::vector<std::vector<std::string>>&& table1_contents,
-                          std::vector<std::vector<std::string>>&& table2_contents,
-                          const std::vector<std::shared_ptr<Synonym>>& new_column_names,
+static auto subtract_impl(const Table& table1, const Table& table2,
                           const std::vector<std::tuple<int, int>>& common_column_idxs) -> Table {
-    // Preconditions:
-    // table1_contents and table2_contents are sorted based on the common columns
-    // table1_contents is superset of table2_contents
+    // Preconditions: table1 is superset of table2
 
-    auto new_table = Table{new_column_names};
+    const auto [rows1, rows2] = sort_rows_on_common_columns(table1, table2, common_column_idxs);
+    auto is_removed = std::vector<bool>(table1.size(), false);
 
-    auto curr_row1 = table1_contents.begin();
-    auto curr_row2 = table2_contents.begin();
-    while (curr_row1 != table1_contents.end() && curr_row2 != table2_contents.end()) {
+    auto curr_row1 = std::size_t{0};
+    auto curr_row2 = std::size_t{0};
+    while (curr_row1 < rows1.size() && curr_row2 < rows2.size()) {
         // Shift row pointers to the first row with the same value in the common column
-        auto all_same = true;
-        for (auto [col_idx1, col_idx2] : common_column_idxs) {
-            if ((*curr_row1)[col_idx1] < (*curr_row2)[col_idx2]) {
-                new_table.add_row(*curr_row1);
-                curr_row1++;
-                all_same = false;
-                break;
-            } else if ((*curr_row1)[col_idx1] > (*curr_row2)[col_idx2]) {
-                curr_row2++;
-                all_same = false;
-                break;
-            }
-        }
-        if (!all_same) {
-            continue;
+        const auto order = compare_on_columns(table1, rows1[curr_row1], table2, rows2[curr_row2], common_column_idxs);
+        if (order < 0) {
+            curr_row1++;
+        } else if (order > 0) {
+            curr_row2++;
+        } else {
+            // All common columns are equal -> advance table1's pointer
+            // Table1 is superset of table2 i.e. table1 may have repeated row (sort of)
+            // So we keep table2's pointer behind
+            is_removed[rows1[curr_row1]] = true;
+            curr_row1++;
         }
-
-        // All common columns are equal -> advance table1's pointer
-        // Table1 is superset of table2 i.e. table1 may have repeated row (sort of)
-        // So we keep table2's pointer behind
-        curr_row1++;
     }
 
-    // Add all remaining rows from table1
-    while (curr_row1 != table1_contents.end()) {
-        new_table.add_row(*curr_row1);
-        curr_row1++;
+    // Keep the remaining rows of table1 in their original order
+    auto kept_rows = std::vector<std::size_t>{};
+    kept_rows.reserve(table1.size());
+    for (std::size_t row = 0; row < table1.size(); row++) {
+        if (!is_removed[row]) {
+            kept_rows.push_back(row);
+        }
     }
 
-    return new_table;
+    return gather_rows(table1, kept_rows);
 }
 
 static auto subtract_tables(Table&& table1, Table&& table2, const std::shared_ptr<pkb::ReadFacade>& read_facade)
@@ -601,6 +674,7 @@ static auto subtract_tables(Table&& table1, Table&& table2, const std::shared_pt
     if (table1.empty() || table2.empty()) {
         return table1;
     }
+    table2.use_dictionary(table1.get_dictionary());
 
     auto table1_column_names = table1.get_column();
     auto table2_column_names = table2.get_column();
@@ -635,11 +709,154 @@ static auto subtract_tables(Table&& table1, Table&& table2, const std::shared_pt
         return subtract_tables(std::move(table1), std::move(table2), read_facade);
     }
 
-    table1.get_column() = std::move(table1_column_names);
-    table2.get_column() = std::move(table2_column_names);
-    reorder_table_data(table1.get_records(), table2.get_records(), ordering1, ordering2, common_column_idxs);
-    return subtract_impl(std::move(table1.get_records()), std::move(table2.get_records()), new_column,
-                         common_column_idxs);
+    table1.reorder_columns(ordering1);
+    table2.reorder_columns(ordering2);
+    return subtract_impl(table1, table2, common_column_idxs);
+}
+
+/**
+ * The rows of a table with one or two columns, as probed by an anti-join. One column is kept as a bitset over the
+ * dense value ids, two columns as a hash set of packed id pairs.
+ */
+class RowSet {
+    std::vector<bool> values;
+    std::unordered_set<std::uint64_t> value_pairs;
+
+    static auto pack(ValueId first, ValueId second) -> std::uint64_t {
+        return (static_cast<std::uint64_t>(first) << 32) | second;
+    }
+
+  public:
+    explicit RowSet(const Table& table) {
+        const auto& firsts = table.get_column_ids(0);
+        if (table.get_column().size() == 1) {
+            values.resize(static_cast<std::size_t>(*std::max_element(firsts.begin(), firsts.end())) + 1);
+            for (auto value : firsts) {
+                values[value] = true;
+            }
+            return;
+        }
+
+        const auto& seconds = table.get_column_ids(1);
+        value_pairs.reserve(table.size());
+        for (std::size_t row = 0; row < table.size(); row++) {
+            value_pairs.insert(pack(firsts[row], seconds[row]));
+        }
+    }
+
+    [[nodiscard]] auto contains(ValueId value) const -> bool {
+        return value < values.size() && values[value];
+    }
+
+    [[nodiscard]] auto contains(ValueId first, ValueId second) const -> bool {
+        return value_pairs.find(pack(first, second)) != value_pairs.end();
+    }
+};
+
+static auto build_domain_table(const std::shared_ptr<Synonym>& synonym, const Domain& domain,
+                               const std::shared_ptr<ValueDictionary>& dictionary) -> Table {
+    return Table{{synonym}, {domain(synonym, dictionary)}, dictionary};
+}
+
+/**
+ * @brief The combinations of domain values for the synonyms of table2 that match none of its rows
+ */
+static auto complement(const Table& table2, const RowSet& excluded, const Domain& domain) -> Table {
+    const auto synonyms = table2.get_column();
+    auto columns = std::vector<std::vector<ValueId>>(synonyms.size());
+    if (synonyms.size() == 1) {
+        columns[0] = domain(synonyms[0], table2.get_dictionary());
+        auto& values = columns[0];
+        values.erase(std::remove_if(values.begin(), values.end(),
+                                    [&excluded](ValueId value) {
+                                        return excluded.contains(value);
+                                    }),
+                     values.end());
+        return Table{synonyms, std::move(columns), table2.get_dictionary()};
+    }
+
+    const auto& dictionary = table2.get_dictionary();
+    const auto firsts = domain(synonyms[0], dictionary);
+    const auto seconds = domain(synonyms[1], dictionary);
+    for (auto first : firsts) {
+        for (auto second : seconds) {
+            if (!excluded.contains(first, second)) {
+                columns[0].push_back(first);
+                columns[1].push_back(second);
+            }
+        }
+    }
+    return Table{synonyms, std::move(columns), table2.get_dictionary()};
+}
+
+/**
+ * @brief Keeps the rows of table1 that match no row of table2, whose synonyms all appear in table1
+ */
+static auto filter_rows(const Table& table1, const Table& table2, const RowSet& excluded) -> Table {
+    const auto idxs = get_mapping_from_synonyms_to_table_names(table1.get_column(), table2.get_column());
+    const auto& firsts = table1.get_column_ids(idxs[0]);
+
+    auto kept_rows = std::vector<std::size_t>{};
+    kept_rows.reserve(table1.size());
+    for (std::size_t row = 0; row < table1.size(); row++) {
+        const auto is_excluded = idxs.size() == 1 ? excluded.contains(firsts[row])
+                                                  : excluded.contains(firsts[row], table1.get_column_ids(idxs[1])[row]);
+        if (!is_excluded) {
+            kept_rows.push_back(row);
+        }
+    }
+    return gather_rows(table1, kept_rows);
+}
+
+/**
+ * @brief Extends each row of table1 with the domain values of the one synonym of table2 it lacks, skipping the
+ * combinations that match a row of table2
+ */
+static auto probe_and_skip(const Table& table1, const Table& table2, const RowSet& excluded, const Domain& domain)
+    -> Table {
+    const auto column_names1 = table1.get_column();
+    const auto column_names2 = table2.get_column();
+    const auto is_first_common =
+        std::find(column_names1.begin(), column_names1.end(), column_names2[0]) != column_names1.end();
+    const auto& common_synonym = is_first_common ? column_names2[0] : column_names2[1];
+    const auto& missing_synonym = is_first_common ? column_names2[1] : column_names2[0];
+
+    const auto common_idx =
+        get_mapping_from_synonyms_to_table_names(column_names1, Synonyms{common_synonym}).front();
+    const auto& common_values = table1.get_column_ids(common_idx);
+    const auto candidates = domain(missing_synonym, table2.get_dictionary());
+
+    auto rows = std::vector<std::size_t>{};
+    auto missing_values = std::vector<ValueId>{};
+    for (std::size_t row = 0; row < table1.size(); row++) {
+        for (auto candidate : candidates) {
+            const auto is_excluded = is_first_common ? excluded.contains(common_values[row], candidate)
+                                                     : excluded.contains(candidate, common_values[row]);
+            if (!is_excluded) {
+                rows.push_back(row);
+                missing_values.push_back(candidate);
+            }
+        }
+    }
+
+    auto new_column = column_names1;
+    new_column.push_back(missing_synonym);
+    auto new_columns = std::vector<std::vector<ValueId>>{};
+    new_columns.reserve(new_column.size());
+    for (int i = 0; i < static_cast<int>(column_names1.size()); i++) {
+        const auto& values = table1.get_column_ids(i);
+        auto& new_values = new_columns.emplace_back();
+        new_values.reserve(rows.size());
+        for (auto row : rows) {
+            new_values.push_back(values[row]);
+        }
+    }
+    new_columns.push_back(std::move(missing_values));
+
+    // The rows of table1 stay in order, so its sort order carries over
+    auto new_table = Table{std::move(new_column), std::move(new_columns), table1.get_dictionary()};
+    new_table.set_sort_key(table1.get_sort_key());
+    return new_table;
 }
 } // namespace qps::detail
 
@@ -662,27 +879,68 @@ auto build_table(const std::shared_ptr<Synonym>& synonym, const std::shared_ptr<
     return curr_table;
 }
 
+auto anti_join(OutputTable&& table1, Table&& table2, const Domain& domain) -> Table {
+    if (table2.empty()) {
+        return is_unit(table1) ? Table{} : std::get<Table>(std::move(table1));
+    }
+
+    const auto column_names2 = table2.get_column();
+    const auto column_names1 = is_unit(table1) ? Synonyms{} : std::get<Table>(table1).get_column();
+    const auto num_common = static_cast<std::size_t>(
+        std::count_if(column_names2.begin(), column_names2.end(), [&column_names1](const auto& name) {
+            return std::find(column_names1.begin(), column_names1.end(), name) != column_names1.end();
+        }));
+    if (!is_unit(table1) && (is_empty(table1) || num_common == 0)) {
+        // No common columns -> no subtraction possible
+        return std::get<Table>(std::move(table1));
+    }
+    if (!is_unit(table1)) {
+        table2.use_dictionary(std::get<Table>(table1).get_dictionary());
+    }
+
+    if (column_names2.size() > 2) {
+        // Clauses have at most two synonyms, so only hand-built tables are subtracted from the extended table
+        auto full_table = std::move(table1);
+        for (const auto& synonym : column_names2) {
+            if (std::find(column_names1.begin(), column_names1.end(), synonym) == column_names1.end()) {
+                full_table =
+                    join(std::move(full_table), detail::build_domain_table(synonym, domain, table2.get_dictionary()));
+            }
+        }
+        return detail::subtract_tables(std::get<Table>(std::move(full_table)), std::move(table2), nullptr);
+    }
+
+    const auto excluded = detail::RowSet{table2};
+    if (is_unit(table1)) {
+        return detail::complement(table2, excluded, domain);
+    }
+    const auto& table = std::get<Table>(table1);
+    if (num_common < column_names2.size()) {
+        return detail::probe_and_skip(table, table2, excluded, domain);
+    }
+    return detail::filter_rows(table, table2, excluded);
+}
+
 auto subtract(OutputTable&& table1, OutputTable&& table2, const std::shared_ptr<pkb::ReadFacade>& read_facade)
     -> Table {
-    return std::visit(overloaded{[&read_facade](UnitTable&&, Table&& table2) -> Table {
-                                     const auto synonyms = table2.get_column();
-                                     return detail::subtract_tables(detail::build_full_table(synonyms, read_facade),
-                                                                    std::move(table2), read_facade);
-                                 },
-                                 [&read_facade](Table&& table1, Table&& table2) -> Table {
-                                     return detail::subtract_tables(std::move(table1), std::move(table2), read_facade);
-                                 },
-                                 [](auto&&, UnitTable&&) -> Table {
-                                     // Subtracting UnitTable from anything must result in an empty table
-                                     return Table{};
-                                 }},
-                      std::move(table1), std::move(table2));
+    if (is_unit(table2)) {
+        // Subtracting UnitTable from anything must result in an empty table
+        return Table{};
+    }
+
+    const auto scan = [&read_facade](const std::shared_ptr<Synonym>& synonym,
+                                     const std::shared_ptr<ValueDictionary>& dictionary) {
+        auto table = build_table(synonym, read_facade);
+        table.use_dictionary(dictionary);
+        return std::move(table.get_column_ids(0));
+    };
+    return anti_join(std::move(table1), std::get<Table>(std::move(table2)), scan);
 }
 
 auto join(OutputTable&& table1, OutputTable&& table2) -> OutputTable {
     return std::visit(overloaded{
                           [](Table&& table1, Table&& table2) -> OutputTable {
-                              return detail::cross_merge_join(std::move(table1), std::move(table2));
+                              return detail::adaptive_join(std::move(table1), std::move(table2));
                           },
                           [](UnitTable&&, UnitTable&&) -> OutputTable {
                               return UnitTable{};
@@ -697,15 +955,129 @@ auto join(OutputTable&& table1, OutputTable&& table2) -> OutputTable {
                       std::move(table1), std::move(table2));
 }
 
+auto drop_columns(OutputTable&& output_table, const Synonyms& synonyms) -> OutputTable {
+    if (synonyms.empty() || is_unit(output_table) || is_empty(output_table)) {
+        return std::move(output_table);
+    }
+
+    const auto& table = std::get<Table>(output_table);
+    const auto column_names = table.get_column();
+    auto kept_idxs = std::vector<int>{};
+    auto kept_names = Synonyms{};
+    for (int i = 0; i < static_cast<int>(column_names.size()); i++) {
+        if (std::find(synonyms.begin(), synonyms.end(), column_names[i]) == synonyms.end()) {
+            kept_idxs.push_back(i);
+            kept_names.push_back(column_names[i]);
+        }
+    }
+
+    if (kept_idxs.size() == column_names.size()) {
+        return std::move(output_table);
+    } else if (kept_idxs.empty()) {
+        return UnitTable{};
+    }
+
+    // Sorting on the kept columns brings the rows that become duplicates together
+    const auto rows = detail::sort_rows_on_columns(table, kept_idxs);
+    auto distinct_rows = std::vector<std::size_t>{};
+    distinct_rows.reserve(rows.size());
+    for (auto row : rows) {
+        const auto is_duplicate =
+            !distinct_rows.empty() && std::all_of(kept_idxs.begin(), kept_idxs.end(), [&](int idx) {
+                const auto& values = table.get_column_ids(idx);
+                return values[row] == values[distinct_rows.back()];
+            });
+        if (!is_duplicate) {
+            distinct_rows.push_back(row);
+        }
+    }
+
+    auto new_columns = std::vector<std::vector<ValueId>>{};
+    new_columns.reserve(kept_idxs.size());
+    for (auto idx : kept_idxs) {
+        const auto& values = table.get_column_ids(idx);
+        auto& new_values = new_columns.emplace_back();
+        new_values.reserve(distinct_rows.size());
+        for (auto row : distinct_rows) {
+            new_values.push_back(values[row]);
+        }
+    }
+
+    auto new_table = Table{kept_names, std::move(new_columns), table.get_dictionary()};
+    new_table.set_sort_key(std::move(kept_names));
+    return new_table;
+}
+
+auto Table::add_row(const std::vector<std::string>& record) -> void {
+    for (size_t i = 0; i < record.size(); ++i) {
+        columns[i].push_back(dictionary->encode(record[i]));
+    }
+    num_rows++;
+    sort_key.clear();
+}
+
+auto Table::use_dictionary(const std::shared_ptr<ValueDictionary>& new_dictionary) -> void {
+    if (new_dictionary.get() == dictionary.get()) {
+        return;
+    }
+
+    // Each distinct id is re-encoded once
+    auto new_ids = std::unordered_map<ValueId, ValueId>{};
+    for (auto& column : columns) {
+        for (auto& id : column) {
+            auto it = new_ids.find(id);
+            if (it == new_ids.end()) {
+                it = new_ids.emplace(id, new_dictionary->encode(dictionary->decode(id))).first;
+            }
+            id = it->second;
+        }
+    }
+    dictionary = new_dictionary;
+    sort_key.clear();
+}
+
+auto Table::get_records() const -> std::vector<std::vector<std::string>> {
+    auto records = std::vector<std::vector<std::string>>(num_rows);
+    for (size_t row = 0; row < num_rows; ++row) {
+        records[row].reserve(columns.size());
+        for (const auto& column : columns) {
+            records[row].push_back(dictionary->decode(column[row]));
+        }
+    }
+    return records;
+}
+
+auto Table::get_column_value(const std::shared_ptr<Synonym>& synonym) const -> std::unordered_set<std::string> {
+    const auto name = synonym->get_name_string();
+    for (size_t i = 0; i < record_type.size(); ++i) {
+        if (record_type[i]->get_name_string() != name) {
+            continue;
+        }
+
+        // Deduplicate on ids before decoding
+        const auto ids = std::unordered_set<ValueId>{columns[i].begin(), columns[i].end()};
+        auto values = std::unordered_set<std::string>{};
+        values.reserve(ids.size());
+        for (auto id : ids) {
+            values.insert(dictionary->decode(id));
+        }
+        return values;
+    }
+    return {};
+}
+
 static auto to_string(const Table& table) -> std::vector<std::string> {
+    const auto& dictionary = *table.get_dictionary();
+    const auto num_columns = static_cast<int>(table.get_column().size());
+
     auto results = std::unordered_set<std::string>{};
-    for (const auto& row : table.get_records()) {
-        auto ss = std::stringstream{};
-        ss << row.front();
-        for (auto it = std::next(row.begin()); it != row.end(); it++) {
-            ss << " " << *it;
+    for (size_t row = 0; row < table.size(); row++) {
+        auto result = dictionary.decode(table.get_column_ids(0)[row]);
+        for (int i = 1; i < num_columns; i++) {
+            result += " ";
+            result += dictionary.decode(table.get_column_ids(i)[row]);
         }
-        results.insert(ss.str());
+        results.insert(std::move(result));
     }
 
     return {results.begin(), results.end()};
@@ -732,11 +1104,26 @@ static auto project_and_transform_table(Table& table, const std::vector<Elem>& e
         extractors.push_back(std::visit(attribute_extractor, element));
     }
 
-    // Apply the extractors
-    for (auto& row : table.get_records()) {
-        for (int i = 0; i < static_cast<int>(row.size()); i++) {
-            row[i] = extractors[i](row[i]);
+    if (table.empty()) {
+        return;
+    }
+
+    // Apply the extractors once per distinct value of each column
+    auto& dictionary = *table.get_dictionary();
+    for (int i = 0; i < static_cast<int>(elements.size()); i++) {
+        if (std::holds_alternative<std::shared_ptr<Synonym>>(elements[i])) {
+            continue; // Synonyms are projected as they are
+        }
+
+        auto transformed = std::unordered_map<ValueId, ValueId>{};
+        for (auto& id : table.get_column_ids(i)) {
+            auto it = transformed.find(id);
+            if (it == transformed.end()) {
+                it = transformed.emplace(id, dictionary.encode(extractors[i](dictionary.decode(id)))).first;
+            }
+            id = it->second;
         }
+        table.set_sort_key({});
     }
 }
 
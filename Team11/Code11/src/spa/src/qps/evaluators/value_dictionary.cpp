@@ -0,0 +1,31 @@
+#include "qps/evaluators/value_dictionary.hpp"
+
+#include <utility>
+
+namespace qps {
+static thread_local std::shared_ptr<ValueDictionary> scoped_dictionary;
+
+ValueDictionary::Scope::Scope(std::shared_ptr<ValueDictionary> dictionary)
+    : previous(std::exchange(scoped_dictionary, std::move(dictionary))) {
+}
+
+ValueDictionary::Scope::~Scope() {
+    scoped_dictionary = std::move(previous);
+}
+
+auto ValueDictionary::current() -> std::shared_ptr<ValueDictionary> {
+    return scoped_dictionary != nullptr ? scoped_dictionary : std::make_shared<ValueDictionary>();
+}
+
+auto ValueDictionary::encode(const std::string& value) -> ValueId {
+    const auto [it, inserted] = ids.try_emplace(value, static_cast<ValueId>(values.size()));
+    if (inserted) {
+        values.push_back(value);
+    }
+    return it->second;
+}
+
+auto ValueDictionary::decode(ValueId id) const -> const std::string& {
+    return values[id];
+}
+} // namespace qps
@@ -0,0 +1,311 @@
+#include "qps/optimisers/cost.hpp"
+#include "qps/parser/entities/attribute.hpp"
+#include "qps/parser/entities/clause.hpp"
+#include "qps/parser/entities/relationship.hpp"
+#include "qps/parser/entities/synonym.hpp"
+#include "qps/template_utils.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <unordered_set>
+#include <variant>
+#include <vector>
+
+namespace qps::details {
+// Next* and Affects are computed per input value, so they cost more than the size of their result suggests
+static constexpr auto COMPUTED_RELATION_PENALTY = 10.0;
+
+// An argument of a clause, either a synonym, a literal or a wildcard
+struct Argument {
+    std::shared_ptr<Synonym> synonym;
+    bool is_literal = false;
+};
+
+struct ClauseEstimate {
+    double size = 0;    // Estimated number of rows when none of the synonyms are bound
+    double penalty = 1; // Multiplier on the size when comparing costs
+    std::vector<std::shared_ptr<Synonym>> synonyms;
+};
+
+template <typename T>
+static auto to_argument(const T& ref) -> Argument {
+    return std::visit(overloaded{[](const WildCard&) {
+                                     return Argument{};
+                                 },
+                                 [](const AttrRef& attr_ref) {
+                                     return Argument{attr_ref.synonym, false};
+                                 },
+                                 [](const auto& value) {
+                                     if constexpr (std::is_convertible_v<std::decay_t<decltype(value)>,
+                                                                         std::shared_ptr<Synonym>>) {
+                                         return Argument{value, false};
+                                     } else {
+                                         return Argument{nullptr, true};
+                                     }
+                                 }},
+                      ref);
+}
+
+static auto to_double(std::size_t value) -> double {
+    return static_cast<double>(std::max<std::size_t>(value, 1));
+}
+
+static auto get_statement_type(const std::shared_ptr<Synonym>& synonym) -> std::optional<StatementType> {
+    if (std::dynamic_pointer_cast<AssignSynonym>(synonym)) {
+        return StatementType::Assign;
+    } else if (std::dynamic_pointer_cast<CallSynonym>(synonym)) {
+        return StatementType::Call;
+    } else if (std::dynamic_pointer_cast<IfSynonym>(synonym)) {
+        return StatementType::If;
+    } else if (std::dynamic_pointer_cast<WhileSynonym>(synonym)) {
+        return StatementType::While;
+    } else if (std::dynamic_pointer_cast<ReadSynonym>(synonym)) {
+        return StatementType::Read;
+    } else if (std::dynamic_pointer_cast<PrintSynonym>(synonym)) {
+        return StatementType::Print;
+    }
+    return std::nullopt;
+}
+
+static auto get_domain_size(const std::shared_ptr<Synonym>& synonym, const pkb::ReadFacade& read_facade) -> double {
+    if (const auto statement_type = get_statement_type(synonym)) {
+        return to_double(read_facade.get_statement_count(statement_type.value()));
+    } else if (std::dynamic_pointer_cast<VarSynonym>(synonym)) {
+        return to_double(read_facade.get_variable_count());
+    } else if (std::dynamic_pointer_cast<ProcSynonym>(synonym)) {
+        return to_double(read_facade.get_procedure_count());
+    } else if (std::dynamic_pointer_cast<ConstSynonym>(synonym)) {
+        return to_double(read_facade.get_constant_count());
+    }
+    return to_double(read_facade.get_statement_count());
+}
+
+/**
+ * @brief Estimate the result of a relation from its statistics, narrowing each side by its argument: a literal keeps
+ * the average fan-out of one value, and a typed statement synonym keeps the pairs whose statement has that type.
+ */
+static auto estimate_relation(const RelationStatistics& statistics, const Argument& key, const Argument& value)
+    -> ClauseEstimate {
+    auto estimate = ClauseEstimate{static_cast<double>(statistics.size), 1, {}};
+    const auto narrow = [&estimate, &statistics](const Argument& argument, std::size_t num_distinct,
+                                                 const StatementTypeHistogram& histogram) {
+        if (argument.is_literal) {
+            estimate.size /= to_double(num_distinct);
+        } else if (argument.synonym != nullptr) {
+            const auto statement_type = get_statement_type(argument.synonym);
+            if (statement_type.has_value() && statistics.size > 0) {
+                estimate.size *= static_cast<double>(histogram[static_cast<std::size_t>(statement_type.value())]) /
+                                 static_cast<double>(statistics.size);
+            }
+            estimate.synonyms.push_back(argument.synonym);
+        }
+    };
+
+    narrow(key, statistics.distinct_keys, statistics.key_histogram);
+    narrow(value, statistics.distinct_values, statistics.value_histogram);
+    return estimate;
+}
+
+// Statistics of a relation over the statements of one type, e.g. the statements matched by a pattern
+static auto statements_of_type(StatementType statement_type, std::size_t num_values,
+                               const pkb::ReadFacade& read_facade) -> RelationStatistics {
+    auto statistics = RelationStatistics{};
+    statistics.size = read_facade.get_statement_count(statement_type);
+    statistics.distinct_keys = statistics.size;
+    statistics.distinct_values = num_values;
+    statistics.key_histogram[static_cast<std::size_t>(statement_type)] = statistics.size;
+    return statistics;
+}
+
+template <typename T>
+static auto get_relation_statistics(const pkb::ReadFacade& read_facade) -> RelationStatistics {
+    const auto& catalog = read_facade.get_statistics();
+    if constexpr (std::is_same_v<T, Follows>) {
+        return catalog.get_relation_statistics(RelationshipType::Follows);
+    } else if constexpr (std::is_same_v<T, FollowsT>) {
+        return catalog.get_relation_statistics(RelationshipType::FollowsStar);
+    } else if constexpr (std::is_same_v<T, Parent>) {
+        return catalog.get_relation_statistics(RelationshipType::Parent);
+    } else if constexpr (std::is_same_v<T, ParentT>) {
+        return catalog.get_relation_statistics(RelationshipType::ParentStar);
+    } else if constexpr (std::is_same_v<T, Next>) {
+        return catalog.get_relation_statistics(RelationshipType::Next);
+    } else if constexpr (std::is_same_v<T, NextT>) {
+        // Within a procedure of n statements, Next* holds for about n^2 / 2 pairs
+        auto statistics = catalog.get_relation_statistics(RelationshipType::Next);
+        const auto next_size = static_cast<double>(statistics.size);
+        const auto scale = next_size / (2 * to_double(catalog.get_procedure_count()));
+        statistics.size = static_cast<std::size_t>(next_size * scale);
+        for (std::size_t i = 0; i < NUM_STATEMENT_TYPES; i++) {
+            statistics.key_histogram[i] = static_cast<std::size_t>(statistics.key_histogram[i] * scale);
+            statistics.value_histogram[i] = static_cast<std::size_t>(statistics.value_histogram[i] * scale);
+        }
+        return statistics;
+    } else if constexpr (std::is_same_v<T, Affects>) {
+        auto statistics = statements_of_type(StatementType::Assign, 0, read_facade);
+        statistics.distinct_values = statistics.size;
+        statistics.value_histogram = statistics.key_histogram;
+        return statistics;
+    } else if constexpr (std::is_same_v<T, UsesS>) {
+        return catalog.get_relation_statistics(RelationshipType::UsesS);
+    } else if constexpr (std::is_same_v<T, ModifiesS>) {
+        return catalog.get_relation_statistics(RelationshipType::ModifiesS);
+    } else if constexpr (std::is_same_v<T, UsesP>) {
+        return catalog.get_relation_statistics(RelationshipType::UsesP);
+    } else if constexpr (std::is_same_v<T, ModifiesP>) {
+        return catalog.get_relation_statistics(RelationshipType::ModifiesP);
+    } else if constexpr (std::is_same_v<T, Calls>) {
+        return catalog.get_relation_statistics(RelationshipType::Calls);
+    } else {
+        return catalog.get_relation_statistics(RelationshipType::CallsStar);
+    }
+}
+
+template <typename T,
+          std::enable_if_t<is_variant_member_v<T, type_list_to_variant_t<DefaultStmtStmtList>>, bool> = true>
+static auto estimate_relationship(const T& stmt_stmt, const pkb::ReadFacade& read_facade) -> ClauseEstimate {
+    auto estimate = estimate_relation(get_relation_statistics<T>(read_facade), to_argument(stmt_stmt.stmt1),
+                                      to_argument(stmt_stmt.stmt2));
+    if constexpr (std::is_same_v<T, NextT> || std::is_same_v<T, Affects>) {
+        estimate.penalty = COMPUTED_RELATION_PENALTY;
+    }
+    return estimate;
+}
+
+template <typename T, std::enable_if_t<is_variant_member_v<T, type_list_to_variant_t<DefaultStmtEntList>>, bool> = true>
+static auto estimate_relationship(const T& stmt_ent, const pkb::ReadFacade& read_facade) -> ClauseEstimate {
+    return estimate_relation(get_relation_statistics<T>(read_facade), to_argument(stmt_ent.stmt),
+                             to_argument(stmt_ent.ent));
+}
+
+template <typename T, std::enable_if_t<is_variant_member_v<T, type_list_to_variant_t<DefaultProcVarList>>, bool> = true>
+static auto estimate_relationship(const T& proc_var, const pkb::ReadFacade& read_facade) -> ClauseEstimate {
+    return estimate_relation(get_relation_statistics<T>(read_facade), to_argument(proc_var.ent1),
+                             to_argument(proc_var.ent2));
+}
+
+template <typename T,
+          std::enable_if_t<is_variant_member_v<T, type_list_to_variant_t<DefaultProcProcList>>, bool> = true>
+static auto estimate_relationship(const T& proc_proc, const pkb::ReadFacade& read_facade) -> ClauseEstimate {
+    return estimate_relation(get_relation_statistics<T>(read_facade), to_argument(proc_proc.procedure1),
+                             to_argument(proc_proc.procedure2));
+}
+
+static auto estimate_clause(const std::shared_ptr<Clause>& clause, const pkb::ReadFacade& read_facade)
+    -> ClauseEstimate {
+    if (const auto such_that_clause = std::dynamic_pointer_cast<SuchThatClause>(clause)) {
+        return std::visit(
+            [&read_facade](const auto& relationship) {
+                return estimate_relationship(relationship, read_facade);
+            },
+            such_that_clause->rel_ref);
+    } else if (const auto pattern_clause = std::dynamic_pointer_cast<PatternClause>(clause)) {
+        // Every matching statement is paired with the variables in its left hand side or condition
+        return std::visit(
+            [&read_facade](const auto& pattern) {
+                const auto synonym = pattern.get_synonym();
+                const auto statistics = statements_of_type(get_statement_type(synonym).value(),
+                                                           read_facade.get_variable_count(), read_facade);
+                return estimate_relation(statistics, Argument{synonym, false}, to_argument(pattern.get_ent_ref()));
+            },
+            pattern_clause->syntactic_pattern);
+    } else if (const auto with_clause = std::dynamic_pointer_cast<WithClause>(clause)) {
+        const auto argument1 = to_argument(with_clause->ref1);
+        const auto argument2 = to_argument(with_clause->ref2);
+        auto estimate = ClauseEstimate{1, 1, {}};
+        for (const auto& argument : {argument1, argument2}) {
+            if (argument.synonym != nullptr) {
+                estimate.synonyms.push_back(argument.synonym);
+            }
+        }
+
+        // Comparing two attributes keeps at most the smaller side, a literal keeps a single value
+        if (argument1.synonym != nullptr && argument2.synonym != nullptr) {
+            estimate.size = std::min(get_domain_size(argument1.synonym, read_facade),
+                                     get_domain_size(argument2.synonym, read_facade));
+        }
+        return estimate;
+    }
+
+    return ClauseEstimate{};
+}
+
+/**
+ * @brief Greedily order the clauses by their estimated cost given the synonyms bound so far. A bound synonym narrows
+ * a clause to the fraction of its domain present in the intermediate table, while a clause sharing no synonym with
+ * the table pays for the cross product.
+ */
+static auto order_by_cost(const std::vector<std::shared_ptr<Clause>>& clauses, const pkb::ReadFacade& read_facade)
+    -> std::vector<std::shared_ptr<Clause>> {
+    auto estimates = std::vector<ClauseEstimate>{};
+    estimates.reserve(clauses.size());
+    for (const auto& clause : clauses) {
+        estimates.push_back(estimate_clause(clause, read_facade));
+    }
+
+    auto is_picked = std::vector<bool>(clauses.size(), false);
+    auto bound_synonyms = std::unordered_set<std::shared_ptr<Synonym>>{};
+    auto table_size = 1.0;
+
+    auto ordered_clauses = std::vector<std::shared_ptr<Clause>>{};
+    ordered_clauses.reserve(clauses.size());
+    for (std::size_t step = 0; step < clauses.size(); step++) {
+        auto best = clauses.size();
+        auto best_cost = 0.0;
+        auto best_size = 0.0;
+        auto is_best_connected = false;
+
+        for (std::size_t i = 0; i < clauses.size(); i++) {
+            if (is_picked[i]) {
+                continue;
+            }
+
+            auto size = estimates[i].size;
+            auto is_connected = false;
+            for (const auto& synonym : estimates[i].synonyms) {
+                if (bound_synonyms.find(synonym) != bound_synonyms.end()) {
+                    size *= std::min(1.0, table_size / get_domain_size(synonym, read_facade));
+                    is_connected = true;
+                }
+            }
+
+            auto cost = size * estimates[i].penalty;
+            if (!is_connected && !bound_synonyms.empty() && !estimates[i].synonyms.empty()) {
+                cost *= table_size;
+            }
+
+            // Ties keep the original order of the clauses
+            if (best == clauses.size() || cost < best_cost) {
+                best = i;
+                best_cost = cost;
+                best_size = size;
+                is_best_connected = is_connected;
+            }
+        }
+
+        is_picked[best] = true;
+        ordered_clauses.push_back(clauses[best]);
+        // Joining on a bound synonym keeps about the narrowed rows of the clause, anything else is a cross product
+        if (is_best_connected) {
+            table_size = std::max(1.0, best_size);
+        } else if (!estimates[best].synonyms.empty()) {
+            table_size *= std::max(1.0, best_size);
+        }
+        bound_synonyms.insert(estimates[best].synonyms.begin(), estimates[best].synonyms.end());
+    }
+
+    return ordered_clauses;
+}
+} // namespace qps::details
+
+namespace qps {
+auto CostOptimiser::optimise(const Query& query) const -> std::vector<Query> {
+    if (read_facade == nullptr || query.clauses.size() < 2) {
+        return {query};
+    }
+
+    return {Query{query.reference, details::order_by_cost(query.clauses, *read_facade)}};
+}
+} // namespace qps
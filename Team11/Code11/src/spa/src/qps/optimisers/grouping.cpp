@@ -324,4 +324,10 @@ static auto group_queries(const Query& query, const std::vector<std::vector<uint
     });
     return grouped_queries;
 }
-} // namespace qps::details
\ No newline at end of file
+} // namespace qps::details
+
+namespace qps {
+auto get_synonyms(const std::shared_ptr<Clause>& clause) -> Synonyms {
+    return std::get<1>(details::to_clause_tuple(0, clause));
+}
+} // namespace qps
@@ -223,12 +223,38 @@ get_next_star_pairs(const std::unordered_map<std::string, std::unordered_set<std
     return next_star_result;
 }
 
+// Returns the view over the children of a node in an adjacency list
+static Neighbours neighbours_of(const std::unordered_map<std::string, std::unordered_set<std::string>>& map) {
+    return [&map](const std::string& node) {
+        auto it = map.find(node);
+        return it != map.end() ? SetView<std::string>{&it->second} : SetView<std::string>{};
+    };
+}
+
 // Check whether there's a transitive rs
 bool has_transitive_rs(const std::string& node1, const std::unordered_set<std::string>& end_nodes,
                        const std::unordered_map<std::string, std::unordered_set<std::string>>& map,
                        const std::function<bool(const std::string&)>& start_node_cond,
                        const std::function<bool(const std::string&)>& end_node_cond,
                        const std::function<bool(const std::string&)>& intermediate_node_cond) {
+    return has_transitive_rs(node1, end_nodes, neighbours_of(map), start_node_cond, end_node_cond,
+                             intermediate_node_cond);
+}
+
+std::unordered_set<std::string>
+get_all_transitive_from_node(const std::string& node,
+                             const std::unordered_map<std::string, std::unordered_set<std::string>>& map,
+                             const std::function<bool(const std::string&)>& start_node_cond,
+                             const std::function<bool(const std::string&)>& end_node_cond,
+                             const std::function<bool(const std::string&)>& intermediate_node_cond) {
+    return get_all_transitive_from_node(node, neighbours_of(map), start_node_cond, end_node_cond,
+                                        intermediate_node_cond);
+}
+
+bool has_transitive_rs(const std::string& node1, const std::unordered_set<std::string>& end_nodes,
+                       const Neighbours& neighbours, const std::function<bool(const std::string&)>& start_node_cond,
+                       const std::function<bool(const std::string&)>& end_node_cond,
+                       const std::function<bool(const std::string&)>& intermediate_node_cond) {
     if (!start_node_cond(node1)) {
         return false;
     }
@@ -248,11 +274,8 @@ bool has_transitive_rs(const std::string& node1, const std::unordered_set<std::s
     std::unordered_set<std::string> visited;
     std::stack<std::string> stack;
 
-    auto it = map.find(node1);
-    if (it != map.end()) {
-        for (const auto& child_node : it->second) {
-            stack.push(child_node);
-        }
+    for (const auto& child_node : neighbours(node1)) {
+        stack.push(child_node);
     }
 
     while (!stack.empty()) {
@@ -273,23 +296,19 @@ bool has_transitive_rs(const std::string& node1, const std::unordered_set<std::s
         visited.insert(current);
 
         // Add all next nodes to stack
-        auto it_current = map.find(current);
-        if (it_current != map.end()) {
-            for (const auto& next_node : it_current->second) {
-                stack.push(next_node);
-            }
+        for (const auto& next_node : neighbours(current)) {
+            stack.push(next_node);
         }
     }
 
     return false;
 }
 
-std::unordered_set<std::string>
-get_all_transitive_from_node(const std::string& node,
-                             const std::unordered_map<std::string, std::unordered_set<std::string>>& map,
-                             const std::function<bool(const std::string&)>& start_node_cond,
-                             const std::function<bool(const std::string&)>& end_node_cond,
-                             const std::function<bool(const std::string&)>& intermediate_node_cond) {
+std::unordered_set<std::string> get_all_transitive_from_node(
+    const std::string& node, const Neighbours& neighbours,
+    const std::function<bool(const std::string&)>& start_node_cond,
+    const std::function<bool(const std::string&)>& end_node_cond,
+    const std::function<bool(const std::string&)>& intermediate_node_cond) {
     if (!start_node_cond(node)) {
         return {};
     }
@@ -298,11 +317,8 @@ get_all_transitive_from_node(const std::string& node,
     std::unordered_set<std::string> visited;
     std::stack<std::string> stack;
 
-    auto it = map.find(node);
-    if (it != map.end()) {
-        for (const auto& next_node : it->second) {
-            stack.push(next_node);
-        }
+    for (const auto& next_node : neighbours(node)) {
+        stack.push(next_node);
     }
 
     while (!stack.empty()) {
@@ -324,11 +340,8 @@ get_all_transitive_from_node(const std::string& node,
         visited.insert(current);
 
         // Add all next nodes to stack
-        auto it_current = map.find(current);
-        if (it_current != map.end()) {
-            for (const auto& next_node : it_current->second) {
-                stack.push(next_node);
-            }
+        for (const auto& next_node : neighbours(current)) {
+            stack.push(next_node);
         }
     }
 
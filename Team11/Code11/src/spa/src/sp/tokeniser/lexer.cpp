@@ -0,0 +1,27 @@
+#include "sp/tokeniser/lexer.hpp"
+
+namespace sp {
+auto SourceProcessorLexer::tokenize(const TokeniserInput& input) const -> TokeniserOutput {
+    auto state = Start;
+    auto accepted_type = std::optional<TokenType>{};
+    auto accepted_length = std::size_t{0};
+
+    for (std::size_t i = 0; i < input.length(); i++) {
+        state = transitions[state][char_classes[static_cast<unsigned char>(input[i])]];
+        if (state == Error) {
+            break;
+        }
+        if (accepts[state].accepting) {
+            accepted_type = accepts[state].type;
+            accepted_length = i + 1;
+        }
+    }
+
+    if (!accepted_type.has_value()) {
+        return std::nullopt;
+    }
+
+    return std::make_tuple(Token{accepted_type.value(), std::string{input.substr(0, accepted_length)}},
+                           input.substr(accepted_length));
+}
+} // namespace sp
@@ -10,7 +10,7 @@ auto NextTraverser::traverse_node(const std::shared_ptr<CfgNode>& node) -> void
     for (size_t i = 1; i < stmt_nums.size(); i++) {
         auto prev_stmt_num = stmt_nums.at(i - 1);
         auto curr_stmt_num = stmt_nums.at(i);
-        write_facade->add_next(std::to_string(prev_stmt_num), std::to_string(curr_stmt_num));
+        next_pairs.emplace_back(std::to_string(prev_stmt_num), std::to_string(curr_stmt_num));
     }
 }
 
@@ -41,7 +41,7 @@ auto NextTraverser::traverse_edge(const std::shared_ptr<CfgNode>& node, const st
         auto outneighbour_stmt_nums = outneighbour->get();
         auto outneighbour_first_stmt_num = std::to_string(outneighbour_stmt_nums.front());
 
-        write_facade->add_next(prev_node_final_stmt_num, outneighbour_first_stmt_num);
+        next_pairs.emplace_back(prev_node_final_stmt_num, outneighbour_first_stmt_num);
     }
 }
 
@@ -78,6 +78,8 @@ auto NextTraverser::traverse(const ProcMap& cfgs) -> void {
     for (const auto& [proc_name, cfg] : cfgs) {
         traverse_procedure(cfg);
     }
+    write_facade->add_all_nexts(std::move(next_pairs));
+    next_pairs = {};
 }
 
 } // namespace sp
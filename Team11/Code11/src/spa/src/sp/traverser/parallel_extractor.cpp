@@ -0,0 +1,121 @@
+#include "sp/traverser/parallel_extractor.hpp"
+#include "common/ast/program_ast.hpp"
+#include "sp/traverser/affects_traverser.hpp"
+#include "sp/traverser/design_entites_populator_traverser.hpp"
+#include "sp/traverser/follows_traverser.hpp"
+#include "sp/traverser/next_traverser.hpp"
+#include "sp/traverser/parent_traverser.hpp"
+
+#include <algorithm>
+#include <unordered_map>
+
+namespace sp {
+namespace {
+/**
+ * @brief The batched facade and traversers owned by one worker thread.
+ */
+struct Worker {
+    std::shared_ptr<pkb::WriteFacade> batch;
+    DesignEntitiesPopulatorTraverser entities_traverser;
+    FollowsTraverser follows_traverser;
+    ParentTraverser parent_traverser;
+    NextTraverser next_traverser;
+    AffectsTraverser affects_traverser;
+
+    explicit Worker(const std::shared_ptr<pkb::WriteFacade>& batch)
+        : batch(batch), entities_traverser(batch), follows_traverser(batch), parent_traverser(batch),
+          next_traverser(batch), affects_traverser(batch) {
+    }
+};
+} // namespace
+
+ParallelExtractor::ParallelExtractor(std::shared_ptr<pkb::WriteFacade> write_facade, std::size_t num_threads)
+    : write_facade(std::move(write_facade)), thread_pool(std::make_unique<ThreadPool>(num_threads)) {
+}
+
+auto ParallelExtractor::get_wavefronts(const Procedures& procedures, const std::vector<std::string>& proc_topo_sort,
+                                       const SemanticValidator::CallGraph& call_graph) -> std::vector<Procedures> {
+    auto proc_map = std::unordered_map<std::string, std::shared_ptr<ProcedureNode>>{};
+    for (const auto& procedure : procedures) {
+        proc_map.insert({procedure->proc_name, procedure});
+    }
+
+    // Callees come before their callers in the topological order, so a procedure's wavefront is final when reached
+    auto wavefront_of = std::unordered_map<std::string, std::size_t>{};
+    auto wavefronts = std::vector<Procedures>{};
+    for (const auto& proc_name : proc_topo_sort) {
+        const auto wavefront = wavefront_of[proc_name];
+        if (wavefront >= wavefronts.size()) {
+            wavefronts.resize(wavefront + 1);
+        }
+        wavefronts[wavefront].push_back(proc_map.at(proc_name));
+
+        const auto callers = call_graph.find(proc_name);
+        if (callers == call_graph.end()) {
+            continue;
+        }
+        for (const auto& caller : callers->second) {
+            wavefront_of[caller] = std::max(wavefront_of[caller], wavefront + 1);
+        }
+    }
+    return wavefronts;
+}
+
+auto ParallelExtractor::extract(const std::shared_ptr<AstNode>& ast, const std::vector<std::string>& proc_topo_sort,
+                                const SemanticValidator::CallGraph& call_graph) -> ProcMap {
+    auto procedures = Procedures{};
+    for (const auto& node : std::dynamic_pointer_cast<ProgramNode>(ast)->procedures) {
+        procedures.push_back(std::dynamic_pointer_cast<ProcedureNode>(node));
+    }
+
+    auto workers = std::vector<Worker>{};
+    workers.reserve(thread_pool->size());
+    for (std::size_t i = 0; i < thread_pool->size(); i++) {
+        workers.emplace_back(write_facade->create_batch());
+    }
+
+    // Step 1. Extract everything that only depends on the procedure itself
+    auto cfgs = std::vector<std::shared_ptr<ProcedureCfg>>(procedures.size());
+    thread_pool->parallel_for(procedures.size(), [&procedures, &workers, &cfgs](std::size_t index, std::size_t w) {
+        const auto& procedure = procedures[index];
+        auto& worker = workers[w];
+        worker.entities_traverser.traverse(procedure, {});
+        worker.follows_traverser.traverse(procedure, {});
+        worker.parent_traverser.traverse(procedure, {});
+
+        auto cfg = std::make_shared<ProcedureCfg>();
+        procedure->stmt_list->build_cfg(cfg);
+        const auto proc_cfg = ProcMap{{procedure->proc_name, cfg}};
+        worker.next_traverser.traverse(proc_cfg);
+        worker.affects_traverser.traverse(proc_cfg);
+        cfgs[index] = cfg;
+    });
+
+    // Step 2. Extract Modifies and Uses one wavefront at a time. Every procedure has its entry in the maps before
+    // extraction starts, so workers only write their own entry and read the entries of earlier wavefronts.
+    auto modify_map = std::make_shared<ModifyMap>();
+    auto uses_map = std::make_shared<UsesMap>();
+    for (const auto& procedure : procedures) {
+        modify_map->insert({procedure->proc_name, {}});
+        uses_map->insert({procedure->proc_name, {}});
+    }
+    for (const auto& wavefront : get_wavefronts(procedures, proc_topo_sort, call_graph)) {
+        thread_pool->parallel_for(wavefront.size(), [&wavefront, &workers, &modify_map, &uses_map](std::size_t index,
+                                                                                                     std::size_t w) {
+            wavefront[index]->populate_pkb_modifies(workers[w].batch, modify_map);
+            wavefront[index]->populate_pkb_uses(workers[w].batch, uses_map);
+        });
+    }
+
+    // Step 3. Merge the batches into the PKB
+    for (auto& worker : workers) {
+        write_facade->commit(*worker.batch);
+    }
+
+    auto proc_map = ProcMap{};
+    for (std::size_t i = 0; i < procedures.size(); i++) {
+        proc_map.insert({procedures[i]->proc_name, cfgs[i]});
+    }
+    return proc_map;
+}
+} // namespace sp
@@ -0,0 +1,46 @@
+#include "catch.hpp"
+#include "common/tokeniser/runner.hpp"
+#include "common/tokeniser/source_file.hpp"
+#include "sp/tokeniser/tokeniser.hpp"
+
+#include <filesystem>
+#include <fstream>
+
+using namespace tokenizer;
+
+TEST_CASE("Test Source File") {
+    const auto path = std::filesystem::temp_directory_path() / "spa_test_source_file.txt";
+    auto source_text = std::string{"procedure main {\n"};
+    for (int i = 0; i < 100000; i++) {
+        source_text += "    x = x + " + std::to_string(i) + ";\n";
+    }
+    source_text += "}\n";
+    {
+        std::ofstream file{path};
+        file << source_text;
+    }
+
+    SECTION("view - success") {
+        auto source = SourceFile{path.string()};
+        REQUIRE(source.view() == source_text);
+
+        source.release_until(source_text.length() / 2);
+        REQUIRE(source.view() == source_text);
+    }
+
+    SECTION("tokenize mapped source - success") {
+        const auto runner = TokenizerRunner{std::make_unique<sp::SourceProcessorTokenizer>(), true};
+        auto source = SourceFile{path.string()};
+
+        const auto tokens = runner.apply_tokeniser(source);
+        const auto expected = runner.apply_tokeniser(source_text);
+        REQUIRE(tokens.size() == expected.size());
+        REQUIRE(tokens[tokens.size() - 4].content == "99999");
+    }
+
+    SECTION("missing file - failure") {
+        REQUIRE_THROWS(SourceFile{(path.parent_path() / "spa_missing_source_file.txt").string()});
+    }
+
+    std::filesystem::remove(path);
+}
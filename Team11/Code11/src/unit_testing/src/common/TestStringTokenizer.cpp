@@ -95,6 +95,16 @@ TEST_CASE("Test string") {
         REQUIRE(rest == "+");
     }
 
+    SECTION("string success - rest views the input") {
+        const auto input = std::string{"abc1+def"};
+        const auto result = string.tokenize(input);
+        REQUIRE(result.has_value());
+
+        const auto& [success, rest] = result.value();
+        REQUIRE(success.content == "abc1");
+        REQUIRE(rest.data() == input.data() + 4);
+    }
+
     SECTION("string failure - empty") {
         const auto result = string.tokenize("");
         REQUIRE(!result.has_value());
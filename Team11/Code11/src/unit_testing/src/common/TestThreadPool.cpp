@@ -0,0 +1,46 @@
+#include "catch.hpp"
+#include "common/utils/thread_pool.hpp"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+TEST_CASE("Test Thread Pool") {
+    auto pool = ThreadPool{4};
+
+    SECTION("parallel for - every index runs once") {
+        auto runs = std::vector<std::atomic<int>>(1000);
+        auto workers_in_range = std::atomic<bool>{true};
+        pool.parallel_for(runs.size(), [&runs, &pool, &workers_in_range](std::size_t index, std::size_t worker) {
+            if (worker >= pool.size()) {
+                workers_in_range = false;
+            }
+            runs[index]++;
+        });
+
+        REQUIRE(workers_in_range);
+        for (const auto& run : runs) {
+            REQUIRE(run == 1);
+        }
+    }
+
+    SECTION("parallel for - reusable across jobs") {
+        auto total = std::atomic<std::size_t>{0};
+        for (int job = 0; job < 10; job++) {
+            pool.parallel_for(100, [&total](std::size_t index, std::size_t) {
+                total += index;
+            });
+        }
+        REQUIRE(total == 10 * 4950);
+    }
+
+    SECTION("parallel for - rethrows task errors") {
+        REQUIRE_THROWS_AS(pool.parallel_for(10,
+                                            [](std::size_t index, std::size_t) {
+                                                if (index == 7) {
+                                                    throw std::runtime_error("task failed");
+                                                }
+                                            }),
+                          std::runtime_error);
+    }
+}
@@ -78,6 +78,77 @@ TEST_CASE("Simple Statement Test") {
     }
 }
 
+TEST_CASE("Symbol Table Test") {
+    SECTION("Statement Ids Follow Statement Order") {
+        auto [read_facade, write_facade] = PkbManager::create_facades();
+
+        write_facade->add_statement("10", StatementType::While);
+        write_facade->add_statement("2", StatementType::Assign);
+        write_facade->add_statement("1", StatementType::Read);
+        write_facade->add_variable("x");
+        write_facade->add_procedure("main");
+
+        REQUIRE_FALSE(read_facade->is_finalised());
+        REQUIRE(read_facade->get_statement_id("1") == INVALID_SYMBOL_ID);
+
+        write_facade->finalise_pkb();
+
+        REQUIRE(read_facade->is_finalised());
+        REQUIRE(read_facade->get_statement_id("1") == 0);
+        REQUIRE(read_facade->get_statement_id("2") == 1);
+        REQUIRE(read_facade->get_statement_id("10") == 2);
+        REQUIRE(read_facade->get_statement_id("11") == INVALID_SYMBOL_ID);
+        REQUIRE(read_facade->get_statement_by_id(2) == "10");
+        REQUIRE(read_facade->get_variable_by_id(read_facade->get_variable_id("x")) == "x");
+        REQUIRE(read_facade->get_procedure_by_id(read_facade->get_procedure_id("main")) == "main");
+
+        REQUIRE(read_facade->has_statement_type(0, StatementType::Read));
+        REQUIRE(read_facade->has_statement_type(2, StatementType::While));
+        REQUIRE_FALSE(read_facade->has_statement_type(1, StatementType::While));
+        REQUIRE_FALSE(read_facade->has_statement_type(INVALID_SYMBOL_ID, StatementType::Read));
+        REQUIRE(read_facade->has_statement("10"));
+        REQUIRE_FALSE(read_facade->has_statement("11"));
+    }
+
+    SECTION("Writing After Finalise Invalidates Ids") {
+        auto [read_facade, write_facade] = PkbManager::create_facades();
+
+        write_facade->add_statement("1", StatementType::Read);
+        write_facade->add_follows("1", "2");
+        write_facade->finalise_pkb();
+        write_facade->add_statement("2", StatementType::Print);
+        write_facade->add_follows("2", "3");
+
+        REQUIRE_FALSE(read_facade->is_finalised());
+        REQUIRE(read_facade->has_print_statement("2"));
+        REQUIRE(read_facade->has_follows_star_relation("1", "2"));
+        REQUIRE(read_facade->contains_follows_key("2"));
+    }
+
+    SECTION("Name Attributes Are Precomputed") {
+        auto [read_facade, write_facade] = PkbManager::create_facades();
+
+        write_facade->add_statement("1", StatementType::Read);
+        write_facade->add_statement_modify_var("1", "x");
+        write_facade->add_statement("2", StatementType::Print);
+        write_facade->add_statement_use_var("2", "y");
+        write_facade->add_statement("3", StatementType::Call);
+        write_facade->add_stmt_no_proc_called_mapping("3", "helper");
+        write_facade->add_statement("4", StatementType::Assign);
+        write_facade->add_statement_modify_var("4", "z");
+
+        // Available before finalising, and served from the precomputed attributes after
+        REQUIRE(read_facade->get_statement_name_attribute("1") == "x");
+        write_facade->finalise_pkb();
+
+        REQUIRE(read_facade->get_statement_name_attribute("1") == "x");
+        REQUIRE(read_facade->get_statement_name_attribute("2") == "y");
+        REQUIRE(read_facade->get_statement_name_attribute("3") == "helper");
+        REQUIRE(read_facade->get_statement_name_attribute("4").empty());
+        REQUIRE(read_facade->get_statement_name_attribute("5").empty());
+    }
+}
+
 TEST_CASE("Follows and FollowsStar Relationship Test") {
     SECTION("Follows and FollowsStar Transitive Relationship Test") {
         auto [read_facade, write_facade] = PkbManager::create_facades();
@@ -1346,6 +1417,77 @@ TEST_CASE("Next Test") {
         REQUIRE(previous.count("2") == 0);
     }
 
+    SECTION("View Next Successors and Predecessors") {
+        auto [read_facade, write_facade] = PkbManager::create_facades();
+
+        write_facade->add_statement("1", StatementType::Assign);
+        write_facade->add_statement("2", StatementType::While);
+        write_facade->add_statement("3", StatementType::Assign);
+        write_facade->add_next("1", "2");
+        write_facade->add_next("2", "3");
+        write_facade->add_next("3", "2");
+
+        const auto collect = [](const SetView<std::string>& view) {
+            return std::unordered_set<std::string>(view.begin(), view.end());
+        };
+
+        REQUIRE(collect(read_facade->view_next_of("2")) == std::unordered_set<std::string>{"3"});
+        REQUIRE(collect(read_facade->view_previous_of("2")) == std::unordered_set<std::string>{"1", "3"});
+        REQUIRE(read_facade->view_next_of("4").empty());
+
+        write_facade->finalise_pkb();
+
+        REQUIRE(read_facade->view_previous_of("2").size() == 2);
+        REQUIRE(collect(read_facade->view_previous_of("2")) == std::unordered_set<std::string>{"1", "3"});
+        REQUIRE(collect(read_facade->view_next_of("1")) == std::unordered_set<std::string>{"2"});
+        REQUIRE(read_facade->view_previous_of("1").empty());
+        REQUIRE(read_facade->view_next_of("4").empty());
+    }
+
+    SECTION("Next* Index Across Cycles and Procedures") {
+        auto [read_facade, write_facade] = PkbManager::create_facades();
+        write_facade->enable_next_star_index();
+
+        for (int i = 1; i <= 7; i++) {
+            write_facade->add_statement(std::to_string(i), StatementType::Assign);
+        }
+        // Procedure 1: 1 -> 2 <-> 3 -> 4
+        write_facade->add_next("1", "2");
+        write_facade->add_next("2", "3");
+        write_facade->add_next("3", "2");
+        write_facade->add_next("3", "4");
+        // Procedure 2: 5 -> 6 -> 7
+        write_facade->add_next("5", "6");
+        write_facade->add_next("6", "7");
+
+        REQUIRE_FALSE(read_facade->has_next_star_index());
+
+        write_facade->finalise_pkb();
+
+        REQUIRE(read_facade->has_next_star_index());
+        REQUIRE(read_facade->has_next_star_relation("1", "4"));
+        REQUIRE(read_facade->has_next_star_relation("2", "2"));
+        REQUIRE(read_facade->has_next_star_relation("3", "2"));
+        REQUIRE(read_facade->has_next_star_relation("5", "7"));
+        REQUIRE_FALSE(read_facade->has_next_star_relation("1", "1"));
+        REQUIRE_FALSE(read_facade->has_next_star_relation("4", "1"));
+        REQUIRE_FALSE(read_facade->has_next_star_relation("1", "5"));
+        REQUIRE_FALSE(read_facade->has_next_star_relation("1", "8"));
+
+        REQUIRE(read_facade->get_next_star_of("1") == std::unordered_set<std::string>{"2", "3", "4"});
+        REQUIRE(read_facade->get_next_star_of("2") == std::unordered_set<std::string>{"2", "3", "4"});
+        REQUIRE(read_facade->get_previous_star_of("4") == std::unordered_set<std::string>{"1", "2", "3"});
+        REQUIRE(read_facade->get_previous_star_of("7") == std::unordered_set<std::string>{"5", "6"});
+        REQUIRE(read_facade->get_next_star_of("7").empty());
+
+        // Any write invalidates the index until the next finalise
+        write_facade->add_next("4", "1");
+        REQUIRE_FALSE(read_facade->has_next_star_index());
+        write_facade->finalise_pkb();
+        REQUIRE(read_facade->has_next_star_relation("1", "1"));
+        REQUIRE(read_facade->has_next_star_relation("4", "3"));
+    }
+
     SECTION("Get Direct Next Successors") {
         auto [read_facade, write_facade] = PkbManager::create_facades();
 
@@ -1375,6 +1517,89 @@ TEST_CASE("Next Test") {
     }
 }
 
+TEST_CASE("Affects Test") {
+    auto [read_facade, write_facade] = PkbManager::create_facades();
+
+    // 1: x = 1; 2: while (i) { 3: y = x; 4: read x; 5: x = y + x; } 6: z = x;
+    write_facade->add_statement("1", StatementType::Assign);
+    write_facade->add_statement("2", StatementType::While);
+    write_facade->add_statement("3", StatementType::Assign);
+    write_facade->add_statement("4", StatementType::Read);
+    write_facade->add_statement("5", StatementType::Assign);
+    write_facade->add_statement("6", StatementType::Assign);
+    write_facade->add_statement_modify_var("1", "x");
+    write_facade->add_statement_modify_var("2", "y");
+    write_facade->add_statement_modify_var("2", "x");
+    write_facade->add_statement_modify_var("3", "y");
+    write_facade->add_statement_modify_var("4", "x");
+    write_facade->add_statement_modify_var("5", "x");
+    write_facade->add_statement_modify_var("6", "z");
+    write_facade->add_statement_use_var("2", "i");
+    write_facade->add_statement_use_var("2", "x");
+    write_facade->add_statement_use_var("2", "y");
+    write_facade->add_statement_use_var("3", "x");
+    write_facade->add_statement_use_var("5", "x");
+    write_facade->add_statement_use_var("5", "y");
+    write_facade->add_statement_use_var("6", "x");
+    write_facade->add_next("1", "2");
+    write_facade->add_next("2", "3");
+    write_facade->add_next("3", "4");
+    write_facade->add_next("4", "5");
+    write_facade->add_next("5", "2");
+    write_facade->add_next("2", "6");
+
+    const auto collect = [](const SetView<std::string>& view) {
+        return std::unordered_set<std::string>(view.begin(), view.end());
+    };
+
+    SECTION("Affects Through Loops and Kills") {
+        REQUIRE(collect(read_facade->view_affected_by("1")) == std::unordered_set<std::string>{"3", "6"});
+        REQUIRE(collect(read_facade->view_affected_by("3")) == std::unordered_set<std::string>{"5"});
+        REQUIRE(collect(read_facade->view_affected_by("5")) == std::unordered_set<std::string>{"3", "6"});
+        REQUIRE(read_facade->view_affected_by("2").empty());
+        REQUIRE(read_facade->view_affected_by("4").empty());
+
+        REQUIRE(collect(read_facade->view_affecting("3")) == std::unordered_set<std::string>{"1", "5"});
+        REQUIRE(collect(read_facade->view_affecting("5")) == std::unordered_set<std::string>{"3"});
+        REQUIRE(collect(read_facade->view_affecting("6")) == std::unordered_set<std::string>{"1", "5"});
+        REQUIRE(read_facade->view_affecting("1").empty());
+
+        REQUIRE(read_facade->has_affects_relation("1", "6"));
+        REQUIRE_FALSE(read_facade->has_affects_relation("1", "5"));
+        REQUIRE_FALSE(read_facade->has_affects_relation("5", "5"));
+    }
+
+    SECTION("Bulk Affects Matches Lazy Lookups") {
+        const auto all_affects = read_facade->get_all_affects();
+        REQUIRE(all_affects.at("1") == std::unordered_set<std::string>{"3", "6"});
+        REQUIRE(all_affects.at("3") == std::unordered_set<std::string>{"5"});
+        REQUIRE(all_affects.at("5") == std::unordered_set<std::string>{"3", "6"});
+        REQUIRE(all_affects.at("6").empty());
+        REQUIRE(all_affects.find("4") == all_affects.end());
+
+        // Lookups are now served from the bulk result
+        REQUIRE(collect(read_facade->view_affecting("3")) == std::unordered_set<std::string>{"1", "5"});
+        REQUIRE(read_facade->view_affecting("1").empty());
+        REQUIRE(read_facade->has_affects_relation("5", "6"));
+
+        write_facade->add_next("3", "5");
+        REQUIRE(read_facade->get_all_affects().at("5") == std::unordered_set<std::string>{"3", "5", "6"});
+    }
+
+    SECTION("Memoised Affects Invalidated by Writes") {
+        write_facade->finalise_pkb();
+        REQUIRE(collect(read_facade->view_affected_by("1")) == std::unordered_set<std::string>{"3", "6"});
+        REQUIRE(collect(read_facade->view_affected_by("1")) == std::unordered_set<std::string>{"3", "6"});
+
+        write_facade->add_next("3", "5");
+        REQUIRE(collect(read_facade->view_affected_by("1")) == std::unordered_set<std::string>{"3", "5", "6"});
+        REQUIRE(collect(read_facade->view_affecting("5")) == std::unordered_set<std::string>{"1", "3", "5"});
+
+        write_facade->finalise_pkb();
+        REQUIRE(read_facade->has_affects_relation("1", "5"));
+    }
+}
+
 TEST_CASE("If Pattern Test") {
     SECTION("Get all if statements with any variables") {
         auto [read_facade, write_facade] = PkbManager::create_facades();
@@ -1537,4 +1762,86 @@ TEST_CASE("While Pattern Test") {
 
         REQUIRE(read_facade->get_all_while_stmt_var_pairs().size() == 4);
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("Statistics Catalog Test") {
+    auto [read_facade, write_facade] = PkbManager::create_facades();
+
+    // procedure main { 1: x = 1; 2: while (i) { 3: call helper; 4: read x; } 5: print x; } procedure helper { 6: y = x; }
+    write_facade->add_procedure("main");
+    write_facade->add_procedure("helper");
+    for (const auto& variable : {"x", "y", "i"}) {
+        write_facade->add_variable(variable);
+    }
+    write_facade->add_constant("1");
+    write_facade->add_statement("1", StatementType::Assign);
+    write_facade->add_statement("2", StatementType::While);
+    write_facade->add_statement("3", StatementType::Call);
+    write_facade->add_statement("4", StatementType::Read);
+    write_facade->add_statement("5", StatementType::Print);
+    write_facade->add_statement("6", StatementType::Assign);
+    write_facade->add_follows("1", "2");
+    write_facade->add_follows("2", "5");
+    write_facade->add_follows("3", "4");
+    write_facade->add_parent("2", "3");
+    write_facade->add_parent("2", "4");
+    write_facade->add_statement_modify_var("1", "x");
+    write_facade->add_statement_modify_var("2", "x");
+    write_facade->add_statement_modify_var("2", "y");
+    write_facade->add_statement_modify_var("3", "y");
+    write_facade->add_statement_modify_var("4", "x");
+    write_facade->add_statement_modify_var("6", "y");
+    write_facade->add_procedure_modify_var("main", "x");
+    write_facade->add_procedure_modify_var("main", "y");
+    write_facade->add_procedure_modify_var("helper", "y");
+    write_facade->add_calls("main", "helper");
+    write_facade->finalise_pkb({"main", "helper"});
+
+    const auto& statistics = read_facade->get_statistics();
+
+    SECTION("Entity and statement counts") {
+        REQUIRE(statistics.get_statement_count() == 6);
+        REQUIRE(statistics.get_statement_count(StatementType::Assign) == 2);
+        REQUIRE(statistics.get_statement_count(StatementType::If) == 0);
+        REQUIRE(statistics.get_procedure_count() == 2);
+        REQUIRE(statistics.get_variable_count() == 3);
+        REQUIRE(statistics.get_constant_count() == 1);
+        REQUIRE(read_facade->get_statement_count(StatementType::While) == 1);
+    }
+
+    SECTION("Direct relations") {
+        const auto& follows = statistics.get_relation_statistics(RelationshipType::Follows);
+        REQUIRE(follows.size == 3);
+        REQUIRE(follows.distinct_keys == 3);
+        REQUIRE(follows.distinct_values == 3);
+        REQUIRE(follows.key_histogram[static_cast<std::size_t>(StatementType::While)] == 1);
+        REQUIRE(follows.value_histogram[static_cast<std::size_t>(StatementType::Print)] == 1);
+
+        const auto& parent = statistics.get_relation_statistics(RelationshipType::Parent);
+        REQUIRE(parent.size == 2);
+        REQUIRE(parent.distinct_keys == 1);
+        REQUIRE(parent.get_average_fan_out() == 2.0);
+        REQUIRE(parent.get_average_fan_in() == 1.0);
+    }
+
+    SECTION("Frozen relations") {
+        const auto& follows_star = statistics.get_relation_statistics(RelationshipType::FollowsStar);
+        REQUIRE(follows_star.size == 4);
+        REQUIRE(follows_star.distinct_keys == 3);
+        REQUIRE(follows_star.distinct_values == 3);
+        REQUIRE(follows_star.key_histogram[static_cast<std::size_t>(StatementType::Assign)] == 2);
+
+        const auto& modifies = statistics.get_relation_statistics(RelationshipType::ModifiesS);
+        REQUIRE(modifies.size == 6);
+        REQUIRE(modifies.distinct_keys == 5);
+        REQUIRE(modifies.distinct_values == 2);
+        REQUIRE(modifies.key_histogram[static_cast<std::size_t>(StatementType::While)] == 2);
+        REQUIRE(modifies.value_histogram == StatementTypeHistogram{});
+
+        REQUIRE(statistics.get_relation_statistics(RelationshipType::ModifiesP).size == 3);
+        REQUIRE(statistics.get_relation_statistics(RelationshipType::Calls).size == 1);
+        REQUIRE(statistics.get_relation_statistics(RelationshipType::CallsStar).size == 1);
+        REQUIRE(statistics.get_relation_statistics(RelationshipType::Next).size == 0);
+        REQUIRE(read_facade->get_relationship_size(RelationshipType::ModifiesS) == 6);
+    }
+}
@@ -1,5 +1,6 @@
 #include "catch.hpp"
 
+#include "pkb/facades/read_facade.h"
 #include "pkb/facades/write_facade.h"
 
 using namespace pkb;
@@ -67,3 +68,49 @@ TEST_CASE("write_facade Test") {
         REQUIRE_NOTHROW(write_facade->add_while_var("2", "y"));
     }
 }
+
+TEST_CASE("write_facade Bulk Writes Test") {
+    auto [read_facade, write_facade] = pkb::PkbManager::create_facades();
+    for (const auto& statement_number : {"1", "2", "3"}) {
+        write_facade->add_statement(statement_number, StatementType::Assign);
+    }
+    write_facade->add_variable("x");
+    write_facade->add_variable("y");
+    write_facade->add_procedure("p1");
+    write_facade->add_procedure("p2");
+
+    SECTION("Pairs are de-duplicated and merged with single writes") {
+        write_facade->add_all_nexts({{"1", "2"}, {"2", "3"}, {"1", "2"}});
+        write_facade->add_next("2", "3");
+        write_facade->add_next("3", "1");
+        write_facade->add_all_statement_modify_vars({{"1", "x"}, {"2", "y"}, {"1", "x"}});
+        write_facade->add_all_calls({{"p1", "p2"}});
+        write_facade->finalise_pkb();
+
+        REQUIRE(read_facade->get_all_next() ==
+                std::unordered_map<std::string, std::unordered_set<std::string>>{
+                    {"1", {"2"}}, {"2", {"3"}}, {"3", {"1"}}});
+        REQUIRE(read_facade->get_all_statements_and_var_modify_pairs() ==
+                std::unordered_set<std::tuple<std::string, std::string>>{{"1", "x"}, {"2", "y"}});
+        REQUIRE(read_facade->get_callees("p1") == std::unordered_set<std::string>{"p2"});
+    }
+
+    SECTION("Pairs are readable before the PKB is finalised") {
+        write_facade->add_all_procedure_use_vars({{"p1", "x"}, {"p1", "y"}});
+
+        REQUIRE(read_facade->get_vars_used_by_procedure("p1") == std::unordered_set<std::string>{"x", "y"});
+    }
+
+    SECTION("Batched bulk writes are committed in bulk") {
+        auto batched = write_facade->create_batch();
+        batched->add_all_while_vars({{"2", "x"}});
+        batched->add_all_while_vars({{"3", "x"}, {"3", "y"}});
+        batched->add_while_var("2", "y");
+        write_facade->commit(*batched);
+        write_facade->finalise_pkb();
+
+        REQUIRE(read_facade->get_all_while_stmt_var_pairs() ==
+                std::unordered_set<std::tuple<std::string, std::string>>{
+                    {"2", "x"}, {"2", "y"}, {"3", "x"}, {"3", "y"}});
+    }
+}
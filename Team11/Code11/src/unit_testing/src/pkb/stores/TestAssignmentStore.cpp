@@ -68,4 +68,37 @@ TEST_CASE("Assignment Store Tests") {
         REQUIRE(assignment_store.get_all_assignments_lhs_rhs_partial(vq, "y").size() == 1);
         REQUIRE(assignment_store.get_all_assignments_lhs_rhs_partial(vx, "1").size() == 3);
     }
-}
\ No newline at end of file
+
+    SECTION("Partial matches only match whole subtrees") {
+        auto vx = Variable("x");
+        auto vy = Variable("y");
+
+        // x = a + b * c, y = (a + b) * c, x = (a + b) * c
+        assignment_store.add_assignment("1", vx, "a b c * + ");
+        assignment_store.add_assignment("2", vy, "a b + c * ");
+        assignment_store.add_assignment("3", vx, "a b + c * ");
+
+        REQUIRE(assignment_store.get_all_assignments_rhs_partial("a b + ") ==
+                std::unordered_set<std::string>{"2", "3"});
+        REQUIRE(assignment_store.get_all_assignments_rhs_partial("b c * ") == std::unordered_set<std::string>{"1"});
+        REQUIRE(assignment_store.get_all_assignments_rhs_partial("c ") ==
+                std::unordered_set<std::string>{"1", "2", "3"});
+        REQUIRE(assignment_store.get_all_assignments_rhs_partial("a b c * + ") ==
+                std::unordered_set<std::string>{"1"});
+        REQUIRE(assignment_store.get_all_assignments_rhs_partial("b c + ").empty());
+        REQUIRE(assignment_store.get_all_assignments_lhs_rhs_partial(vx, "a b + ") ==
+                std::unordered_set<std::string>{"3"});
+        REQUIRE(assignment_store.get_all_assignments_lhs_rhs_partial(vy, "b c * ").empty());
+    }
+
+    SECTION("Malformed rhs still matches on lhs") {
+        auto vx = Variable("x");
+
+        assignment_store.add_assignment("1", vx, "1 +");
+        assignment_store.add_assignment("2", vx, "1");
+
+        REQUIRE(assignment_store.get_all_assignments_lhs(vx) == std::unordered_set<std::string>{"1", "2"});
+        REQUIRE(assignment_store.get_all_assignments_rhs("1") == std::unordered_set<std::string>{"2"});
+        REQUIRE(assignment_store.get_all_assignments_rhs_partial("1") == std::unordered_set<std::string>{"2"});
+    }
+}
@@ -0,0 +1,38 @@
+#include <catch.hpp>
+
+#include "pkb/stores/pattern_matching_store/expression_dag.h"
+
+TEST_CASE("Expression DAG Tests") {
+    ExpressionDag expressions;
+
+    SECTION("Identical subexpressions share one node") {
+        // a + b * c and (a + b) * c share the leaves only
+        auto first = expressions.add("a b c * + ");
+        auto second = expressions.add("a b + c * ");
+        REQUIRE(first.size() == 5);
+        REQUIRE(second.size() == 5);
+        REQUIRE(expressions.size() == 7);
+
+        // (b * c) reuses the node of the subtree in the first expression
+        auto third = expressions.add("b c * ");
+        REQUIRE(third.back() == first[3]);
+        REQUIRE(expressions.size() == 7);
+    }
+
+    SECTION("Expressions are found by structure") {
+        auto ids = expressions.add("x y + 2 * ");
+
+        REQUIRE(expressions.find("x y + 2 * ") == ids.back());
+        REQUIRE(expressions.find("x y +") == ids[2]);
+        REQUIRE(expressions.find("2 ") == ids[3]);
+        REQUIRE_FALSE(expressions.find("y x + ").has_value());
+        REQUIRE_FALSE(expressions.find("y 2 * ").has_value());
+        REQUIRE_FALSE(expressions.find("z ").has_value());
+    }
+
+    SECTION("Malformed expressions have no nodes") {
+        REQUIRE(expressions.add("x + ").empty());
+        REQUIRE(expressions.add("x y ").empty());
+        REQUIRE_FALSE(expressions.find("x y ").has_value());
+    }
+}
@@ -0,0 +1,57 @@
+#include <catch.hpp>
+
+#include "pkb/stores/pattern_match_cache.h"
+
+TEST_CASE("Pattern Match Cache Tests") {
+    auto computations = 0;
+    const auto compute = [&computations]() {
+        computations++;
+        return PatternMatchCache::StatementSet{std::to_string(computations)};
+    };
+
+    SECTION("Repeated specs are served from the cache") {
+        PatternMatchCache cache;
+
+        REQUIRE(cache.get_matches("", "x y + ", true, compute) == PatternMatchCache::StatementSet{"1"});
+        REQUIRE(cache.get_matches("", "x  y +", true, compute) == PatternMatchCache::StatementSet{"1"});
+        REQUIRE(computations == 1);
+
+        // Exact and partial matches, and different left-hand sides, are cached separately
+        cache.get_matches("", "x y + ", false, compute);
+        cache.get_matches("v", "x y + ", true, compute);
+        REQUIRE(computations == 3);
+
+        REQUIRE(cache.get_statistics().hits == 1);
+        REQUIRE(cache.get_statistics().misses == 3);
+        REQUIRE(cache.get_statistics().hit_rate() == 0.25);
+    }
+
+    SECTION("The least recently used entry is evicted") {
+        PatternMatchCache cache(2);
+
+        cache.get_matches("", "a ", true, compute);
+        cache.get_matches("", "b ", true, compute);
+        cache.get_matches("", "a ", true, compute);
+        cache.get_matches("", "c ", true, compute);
+        REQUIRE(cache.get_statistics().evictions == 1);
+
+        cache.get_matches("", "a ", true, compute);
+        REQUIRE(computations == 3);
+        cache.get_matches("", "b ", true, compute);
+        REQUIRE(computations == 4);
+    }
+
+    SECTION("The hook reports every lookup and clearing keeps the statistics") {
+        PatternMatchCache cache;
+        auto reported_lookups = std::size_t{0};
+        cache.set_hook([&reported_lookups](const PatternMatchCache::Statistics& statistics) {
+            reported_lookups = statistics.hits + statistics.misses;
+        });
+
+        cache.get_matches("", "a ", true, compute);
+        cache.clear();
+        cache.get_matches("", "a ", true, compute);
+        REQUIRE(computations == 2);
+        REQUIRE(reported_lookups == 2);
+    }
+}
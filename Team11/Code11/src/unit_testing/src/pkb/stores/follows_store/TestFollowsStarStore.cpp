@@ -14,4 +14,27 @@ TEST_CASE("Follows* Store Tests") {
         REQUIRE(follows_star_store.contains_key_val_pair("2", "3"));
         REQUIRE(follows_star_store.contains_key_val_pair("1", "3"));
     }
+
+    SECTION("Frozen Follows* relationships") {
+        auto symbols = std::make_shared<SymbolTable<StatementNumber>>();
+        follows_star_store.add("1", "2");
+        follows_star_store.add("2", "3");
+        follows_star_store.add("1", "3");
+        follows_star_store.freeze(symbols, symbols);
+
+        REQUIRE(follows_star_store.is_frozen());
+        REQUIRE(follows_star_store.contains_key_val_pair("1", "3"));
+        REQUIRE_FALSE(follows_star_store.contains_key_val_pair("3", "1"));
+        REQUIRE_FALSE(follows_star_store.contains_key_val_pair("1", "4"));
+        REQUIRE(follows_star_store.get_vals_by_key("1") == std::unordered_set<StatementNumber>{"2", "3"});
+        REQUIRE(follows_star_store.get_vals_by_key(symbols->get_id("1")).size() == 2);
+        REQUIRE(follows_star_store.get_keys_by_val(symbols->get_id("3")).size() == 2);
+        REQUIRE(follows_star_store.get_all_pairs().size() == 3);
+
+        follows_star_store.add("3", "4");
+
+        REQUIRE_FALSE(follows_star_store.is_frozen());
+        REQUIRE(follows_star_store.contains_key_val_pair("1", "2"));
+        REQUIRE(follows_star_store.contains_key_val_pair("3", "4"));
+    }
 }
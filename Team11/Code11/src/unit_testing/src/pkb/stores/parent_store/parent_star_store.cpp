@@ -14,4 +14,24 @@ TEST_CASE("Parent* Store Tests") {
         REQUIRE(parent_star_store.contains_key_val_pair("2", "3"));
         REQUIRE(parent_star_store.contains_key_val_pair("3", "4"));
     }
+
+    SECTION("Frozen Parent* relationships with dense rows") {
+        auto symbols = std::make_shared<SymbolTable<StatementNumber>>();
+        for (int i = 2; i <= 100; i++) {
+            parent_star_store.add("1", std::to_string(i));
+        }
+        parent_star_store.add("50", "51");
+        parent_star_store.freeze(symbols, symbols, true);
+
+        REQUIRE(parent_star_store.is_frozen());
+        REQUIRE(parent_star_store.contains_key_val_pair("1", "2"));
+        REQUIRE(parent_star_store.contains_key_val_pair("1", "65"));
+        REQUIRE(parent_star_store.contains_key_val_pair("1", "100"));
+        REQUIRE(parent_star_store.contains_key_val_pair("50", "51"));
+        REQUIRE_FALSE(parent_star_store.contains_key_val_pair("1", "1"));
+        REQUIRE_FALSE(parent_star_store.contains_key_val_pair("50", "52"));
+        REQUIRE_FALSE(parent_star_store.contains_key_val_pair("2", "3"));
+        REQUIRE(parent_star_store.get_vals_by_key(symbols->get_id("1")).size() == 99);
+        REQUIRE(parent_star_store.get_keys_by_val("51") == std::unordered_set<StatementNumber>{"1", "50"});
+    }
 }
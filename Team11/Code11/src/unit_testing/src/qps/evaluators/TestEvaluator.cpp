@@ -426,3 +426,240 @@ TEST_CASE("Read Facade Caching") {
         require_equal(results, std::vector<std::string>{"0"});
     }
 }
+
+TEST_CASE("Test Evaluator Independent Groups") {
+    const auto& [read_facade, write_facade] = pkb::PkbManager::create_facades();
+
+    // Populate PkbManager
+    for (int i = 1; i <= 5; i++) {
+        write_facade->add_statement(std::to_string(i), StatementType::Assign);
+    }
+    for (int i = 1; i < 5; i++) {
+        write_facade->add_follows(std::to_string(i), std::to_string(i + 1));
+    }
+    write_facade->finalise_pkb();
+
+    auto sequential_evaluator = QueryEvaluator{read_facade};
+    auto parallel_evaluator = QueryEvaluator{read_facade, 4};
+
+    SECTION("Evaluate - Groups are joined") {
+        // Follows(s1, 2), Follows(s2, s3) and Follows(s4, 5) share no synonyms
+        const auto query = Query{
+            std::vector<Elem>{std::make_shared<AnyStmtSynonym>("s1"), std::make_shared<AnyStmtSynonym>("s2"),
+                              std::make_shared<AnyStmtSynonym>("s4")},
+            std::vector<std::shared_ptr<Clause>>{
+                std::make_shared<SuchThatClause>(Follows{std::make_shared<AnyStmtSynonym>("s1"), Integer{"2"}}, false),
+                std::make_shared<SuchThatClause>(
+                    Follows{std::make_shared<AnyStmtSynonym>("s2"), std::make_shared<AnyStmtSynonym>("s3")}, false),
+                std::make_shared<SuchThatClause>(Follows{std::make_shared<AnyStmtSynonym>("s4"), Integer{"5"}}, false),
+            },
+        };
+
+        const auto expected = sequential_evaluator.evaluate(query);
+        REQUIRE(expected.size() == 4);
+        require_equal(parallel_evaluator.evaluate(query), expected);
+    }
+
+    SECTION("Evaluate - An empty group empties the result") {
+        const auto query = Query{
+            std::vector<Elem>{std::make_shared<AnyStmtSynonym>("s1"), std::make_shared<AnyStmtSynonym>("s2")},
+            std::vector<std::shared_ptr<Clause>>{
+                std::make_shared<SuchThatClause>(
+                    Follows{std::make_shared<AnyStmtSynonym>("s1"), std::make_shared<AnyStmtSynonym>("s3")}, false),
+                std::make_shared<SuchThatClause>(Follows{Integer{"5"}, std::make_shared<AnyStmtSynonym>("s2")}, false),
+            },
+        };
+
+        REQUIRE(sequential_evaluator.evaluate(query).empty());
+        REQUIRE(parallel_evaluator.evaluate(query).empty());
+    }
+}
+
+TEST_CASE("Test Evaluator Clause Demands") {
+    const auto& [read_facade, write_facade] = pkb::PkbManager::create_facades();
+    write_facade->enable_next_star_index();
+
+    // Populate PkbManager
+    for (int i = 1; i <= 4; i++) {
+        write_facade->add_statement(std::to_string(i), StatementType::Assign);
+    }
+    for (int i = 1; i < 4; i++) {
+        write_facade->add_next(std::to_string(i), std::to_string(i + 1));
+    }
+    write_facade->finalise_pkb();
+
+    auto evaluator = QueryEvaluator{read_facade};
+
+    SECTION("Evaluate - Unused synonyms keep distinct values") {
+        // s2 is used nowhere else, so each s1 is emitted once
+        const auto query = Query{
+            std::make_shared<AnyStmtSynonym>("s1"),
+            std::vector<std::shared_ptr<Clause>>{
+                std::make_shared<SuchThatClause>(
+                    NextT{std::make_shared<AnyStmtSynonym>("s1"), std::make_shared<AnyStmtSynonym>("s2")}, false),
+            },
+        };
+
+        require_equal(evaluator.evaluate(query), std::vector<std::string>{"1", "2", "3"});
+    }
+
+    SECTION("Evaluate - Synonyms are dropped after their last use") {
+        // s2 and s3 each join two clauses and are not selected
+        const auto s1 = std::make_shared<AnyStmtSynonym>("s1");
+        const auto s2 = std::make_shared<AnyStmtSynonym>("s2");
+        const auto s3 = std::make_shared<AnyStmtSynonym>("s3");
+        const auto s4 = std::make_shared<AnyStmtSynonym>("s4");
+        const auto query = Query{
+            s4,
+            std::vector<std::shared_ptr<Clause>>{
+                std::make_shared<SuchThatClause>(NextT{s1, s2}, false),
+                std::make_shared<SuchThatClause>(NextT{s2, s3}, false),
+                std::make_shared<SuchThatClause>(NextT{s3, s4}, false),
+            },
+        };
+
+        // Each intermediate table keeps only the synonym that links it to the next clause
+        const auto plan = detail::plan_columns(query);
+        REQUIRE(plan.dead_after == std::vector<Synonyms>{{s1}, {s2}, {s3}});
+        REQUIRE(plan.demands[0].unneeded == Synonyms{s1});
+        REQUIRE(plan.demands[1].unneeded.empty());
+        REQUIRE(plan.demands[2].unneeded.empty());
+
+        require_equal(evaluator.evaluate(query), std::vector<std::string>{"4"});
+    }
+
+    SECTION("Evaluate - BOOLEAN queries only need a witness") {
+        const auto holds = Query{
+            BooleanReference{},
+            std::vector<std::shared_ptr<Clause>>{
+                std::make_shared<SuchThatClause>(
+                    NextT{std::make_shared<AnyStmtSynonym>("s1"), std::make_shared<AnyStmtSynonym>("s2")}, false),
+            },
+        };
+        const auto fails = Query{
+            BooleanReference{},
+            std::vector<std::shared_ptr<Clause>>{
+                std::make_shared<SuchThatClause>(
+                    NextT{std::make_shared<AnyStmtSynonym>("s"), std::make_shared<AnyStmtSynonym>("s")}, false),
+            },
+        };
+
+        require_equal(evaluator.evaluate(holds), std::vector<std::string>{"TRUE"});
+        require_equal(evaluator.evaluate(fails), std::vector<std::string>{"FALSE"});
+    }
+}
+
+TEST_CASE("Test Evaluator Access Paths") {
+    const auto& [read_facade, write_facade] = pkb::PkbManager::create_facades();
+
+    // Populate PkbManager
+    for (int i = 1; i <= 5; i++) {
+        write_facade->add_statement(std::to_string(i), StatementType::Assign);
+    }
+    for (int i = 1; i < 5; i++) {
+        write_facade->add_follows(std::to_string(i), std::to_string(i + 1));
+    }
+    write_facade->finalise_pkb();
+
+    auto evaluator = QueryEvaluator{read_facade};
+    const auto trace = std::make_shared<QueryTrace>();
+    evaluator.set_trace(trace);
+
+    SECTION("Evaluate - Narrowed domains are probed") {
+        // Follows(s1, 2) narrows s1 to a single statement before Follows(s1, s2) is evaluated
+        const auto query = Query{
+            std::make_shared<AnyStmtSynonym>("s2"),
+            std::vector<std::shared_ptr<Clause>>{
+                std::make_shared<SuchThatClause>(Follows{std::make_shared<AnyStmtSynonym>("s1"), Integer{"2"}}, false),
+                std::make_shared<SuchThatClause>(
+                    Follows{std::make_shared<AnyStmtSynonym>("s1"), std::make_shared<AnyStmtSynonym>("s2")}, false),
+            },
+        };
+
+        require_equal(evaluator.evaluate(query), std::vector<std::string>{"2"});
+        const auto entries = trace->get_entries();
+        REQUIRE(entries.size() == 1);
+        REQUIRE(entries[0].choice.access_path == AccessPath::Probe);
+        REQUIRE(entries[0].choice.num_candidates == 1);
+        REQUIRE(entries[0].choice.relation_size == 4);
+    }
+
+    SECTION("Evaluate - Unbound domains are scanned") {
+        const auto query = Query{
+            std::make_shared<AnyStmtSynonym>("s1"),
+            std::vector<std::shared_ptr<Clause>>{
+                std::make_shared<SuchThatClause>(
+                    Follows{std::make_shared<AnyStmtSynonym>("s1"), std::make_shared<AnyStmtSynonym>("s2")}, false),
+            },
+        };
+
+        require_equal(evaluator.evaluate(query), std::vector<std::string>{"1", "2", "3", "4"});
+        const auto entries = trace->get_entries();
+        REQUIRE(entries.size() == 1);
+        REQUIRE(entries[0].choice.access_path == AccessPath::Scan);
+        REQUIRE(entries[0].choice.num_candidates == 5);
+    }
+}
+
+TEST_CASE("Test Evaluator With Clauses") {
+    const auto& [read_facade, write_facade] = pkb::PkbManager::create_facades();
+
+    // Populate PkbManager
+    write_facade->add_procedure("main");
+    write_facade->add_procedure("helper");
+    write_facade->add_variable("x");
+    write_facade->add_variable("y");
+    write_facade->add_constant("2");
+    write_facade->add_constant("7");
+    write_facade->add_statement("1", StatementType::Read);
+    write_facade->add_statement_modify_var("1", "x");
+    write_facade->add_statement("2", StatementType::Print);
+    write_facade->add_statement_use_var("2", "x");
+    write_facade->add_statement("3", StatementType::Print);
+    write_facade->add_statement_use_var("3", "y");
+    write_facade->add_statement("4", StatementType::Call);
+    write_facade->add_stmt_no_proc_called_mapping("4", "helper");
+    write_facade->finalise_pkb();
+
+    auto evaluator = QueryEvaluator{read_facade};
+
+    SECTION("Evaluate - Names of different statements") {
+        const auto query = Query{
+            std::vector<Elem>{std::make_shared<ReadSynonym>("r"), std::make_shared<PrintSynonym>("pn")},
+            std::vector<std::shared_ptr<Clause>>{
+                std::make_shared<WithClause>(
+                    TypedRef{AttrRef(std::make_shared<ReadSynonym>("r"), VarName{}, AttrRef::Type::Name)},
+                    TypedRef{AttrRef(std::make_shared<PrintSynonym>("pn"), VarName{}, AttrRef::Type::Name)}, false),
+            },
+        };
+
+        require_equal(evaluator.evaluate(query), std::vector<std::string>{"1 2"});
+    }
+
+    SECTION("Evaluate - Names of statements and entities") {
+        const auto query = Query{
+            std::make_shared<ProcSynonym>("p"),
+            std::vector<std::shared_ptr<Clause>>{
+                std::make_shared<WithClause>(
+                    TypedRef{AttrRef(std::make_shared<ProcSynonym>("p"), ProcName{}, AttrRef::Type::Name)},
+                    TypedRef{AttrRef(std::make_shared<CallSynonym>("cl"), ProcName{}, AttrRef::Type::Name)}, false),
+            },
+        };
+
+        require_equal(evaluator.evaluate(query), std::vector<std::string>{"helper"});
+    }
+
+    SECTION("Evaluate - Constants and statement numbers") {
+        const auto query = Query{
+            std::make_shared<AnyStmtSynonym>("s"),
+            std::vector<std::shared_ptr<Clause>>{
+                std::make_shared<WithClause>(
+                    TypedRef{AttrRef(std::make_shared<ConstSynonym>("c"), Value{}, AttrRef::Type::Integer)},
+                    TypedRef{AttrRef(std::make_shared<AnyStmtSynonym>("s"), StmtNum{}, AttrRef::Type::Integer)},
+                    false),
+            },
+        };
+
+        require_equal(evaluator.evaluate(query), std::vector<std::string>{"2"});
+    }
+}
@@ -4,9 +4,11 @@
 #include "pkb/facades/write_facade.h"
 #include "pkb/pkb_manager.h"
 #include "qps/evaluators/results_table.hpp"
+#include "qps/evaluators/value_dictionary.hpp"
 #include "qps/parser/entities/synonym.hpp"
 #include <cstdlib>
 #include <memory>
+#include <set>
 #include <unordered_set>
 #include <variant>
 #include <vector>
@@ -75,6 +77,79 @@ TEST_CASE("Test Table") {
     REQUIRE(records[2][0] == "3");
 }
 
+TEST_CASE("Test Columnar Table") {
+    const auto s = std::make_shared<AnyStmtSynonym>("s");
+    const auto v = std::make_shared<VarSynonym>("v");
+    const auto scope = ValueDictionary::Scope{std::make_shared<ValueDictionary>()};
+
+    auto table1 = Table{{s, v}};
+    table1.add_row({"1", "x"});
+    table1.add_row({"2", "x"});
+    table1.add_row({"2", "y"});
+
+    auto table2 = Table{{v}};
+    table2.add_row({"x"});
+
+    REQUIRE(table1.size() == 3);
+    REQUIRE(table1.get_column_ids(0).size() == 3);
+
+    // Equal values share an id across the tables of a dictionary
+    REQUIRE(table1.get_column_ids(1)[0] == table1.get_column_ids(1)[1]);
+    REQUIRE(table1.get_column_ids(1)[0] == table2.get_column_ids(0)[0]);
+    REQUIRE(table1.get_column_ids(1)[0] != table1.get_column_ids(1)[2]);
+
+    REQUIRE(table1.get_column_value(s) == std::unordered_set<std::string>{"1", "2"});
+    REQUIRE(table1.get_column_value(v) == std::unordered_set<std::string>{"x", "y"});
+    REQUIRE(table2.get_column_value(s).empty());
+
+    const auto result = join(std::move(table1), std::move(table2));
+    REQUIRE(std::holds_alternative<Table>(result));
+    const auto& table = std::get<Table>(result);
+    REQUIRE(table.size() == 2);
+    REQUIRE(table.get_column_value(s) == std::unordered_set<std::string>{"1", "2"});
+    REQUIRE(table.get_column_value(v) == std::unordered_set<std::string>{"x"});
+}
+
+TEST_CASE("Test Value Dictionaries") {
+    const auto s = std::make_shared<AnyStmtSynonym>("s");
+    const auto v = std::make_shared<VarSynonym>("v");
+
+    auto table1 = Table{{s, v}};
+    table1.add_row({"1", "x"});
+    table1.add_row({"2", "y"});
+
+    auto table2 = Table{{v}};
+    {
+        const auto scope = ValueDictionary::Scope{std::make_shared<ValueDictionary>()};
+        table2 = Table{{v}};
+        table2.add_row({"y"});
+        table2.add_row({"z"});
+    }
+
+    // Tables created outside of any scope, or in different scopes, do not share a dictionary
+    REQUIRE(table1.get_dictionary().get() != table2.get_dictionary().get());
+
+    SECTION("Re-encoding keeps the values") {
+        table2.use_dictionary(table1.get_dictionary());
+        REQUIRE(table2.get_dictionary().get() == table1.get_dictionary().get());
+        REQUIRE(table1.get_column_ids(1)[1] == table2.get_column_ids(0)[0]);
+        REQUIRE(table2.get_column_value(v) == std::unordered_set<std::string>{"y", "z"});
+    }
+
+    SECTION("Join matches values across dictionaries") {
+        const auto result = join(std::move(table1), std::move(table2));
+        REQUIRE(std::holds_alternative<Table>(result));
+        const auto& table = std::get<Table>(result);
+        REQUIRE(table.size() == 1);
+        REQUIRE(table.get_column_value(s) == std::unordered_set<std::string>{"2"});
+    }
+
+    SECTION("Anti-join matches values across dictionaries") {
+        const auto table = subtract(std::move(table1), std::move(table2), nullptr);
+        REQUIRE(table.get_records() == std::vector<std::vector<std::string>>{{"1", "x"}});
+    }
+}
+
 TEST_CASE("Test Join") {
     SECTION("Cross-Product") {
         auto table1 = Table{{std::make_shared<AnyStmtSynonym>("s")}};
@@ -116,6 +191,116 @@ TEST_CASE("Test Join") {
     }
 }
 
+TEST_CASE("Test Join Strategies") {
+    const auto s = std::make_shared<AnyStmtSynonym>("s");
+    const auto v = std::make_shared<VarSynonym>("v");
+    const auto a = std::make_shared<AssignSynonym>("a");
+
+    const auto to_set = [](const Table& table) {
+        auto column = table.get_column();
+        const auto ordering = detail::sort_and_get_order(column);
+        auto rows = std::set<std::vector<std::string>>{};
+        for (auto record : table.get_records()) {
+            reorder(record, ordering);
+            rows.insert(record);
+        }
+        return rows;
+    };
+
+    auto table1 = Table{{s, v}};
+    table1.add_row({"3", "z"});
+    table1.add_row({"1", "x"});
+    table1.add_row({"2", "x"});
+    table1.add_row({"2", "y"});
+
+    auto table2 = Table{{v, a, s}};
+    table2.add_row({"x", "5", "2"});
+    table2.add_row({"x", "6", "2"});
+    table2.add_row({"y", "7", "2"});
+    table2.add_row({"x", "8", "1"});
+    table2.add_row({"z", "9", "4"});
+
+    SECTION("Strategy selection") {
+        auto other = Table{{a}};
+        other.add_row({"5"});
+        other.add_row({"6"});
+
+        REQUIRE(detail::select_join_strategy(table1, other) == detail::JoinStrategy::Cross);
+        REQUIRE(detail::select_join_strategy(table1, Table{}) == detail::JoinStrategy::Cross);
+        REQUIRE(detail::select_join_strategy(table1, table2) == detail::JoinStrategy::Hash);
+
+        // A single row is trivially sorted
+        auto single = Table{{v}};
+        single.add_row({"x"});
+        REQUIRE(detail::select_join_strategy(table2, single) == detail::JoinStrategy::Hash);
+        auto sorted = Table{{v}};
+        sorted.add_row({"x"});
+        sorted.add_row({"y"});
+        sorted.set_sort_key({v});
+        REQUIRE(detail::select_join_strategy(sorted, single) == detail::JoinStrategy::Merge);
+    }
+
+    SECTION("Strategy selection by size") {
+        auto large_sorted = Table{{v}};
+        auto large_unsorted = Table{{v}};
+        for (auto i = 0; i < 1000; i++) {
+            large_sorted.add_row({"v" + std::to_string(i)});
+            large_unsorted.add_row({"v" + std::to_string(i)});
+        }
+        large_sorted.set_sort_key({v});
+
+        auto small_sorted = Table{{v}};
+        auto small_unsorted = Table{{v}};
+        for (auto i = 0; i < 10; i++) {
+            small_sorted.add_row({"v" + std::to_string(i)});
+            small_unsorted.add_row({"v" + std::to_string(i)});
+        }
+        small_sorted.set_sort_key({v});
+
+        // Both sorted: the merge needs no sorting
+        REQUIRE(detail::select_join_strategy(large_sorted, small_sorted) == detail::JoinStrategy::Merge);
+        // Only the large side is sorted: sorting ten rows is cheaper than hashing a thousand
+        REQUIRE(detail::select_join_strategy(small_unsorted, large_sorted) == detail::JoinStrategy::Merge);
+        // Only the small side is sorted: sorting the large side costs more than hashing both
+        REQUIRE(detail::select_join_strategy(large_unsorted, small_sorted) == detail::JoinStrategy::Hash);
+        // Neither is sorted
+        REQUIRE(detail::select_join_strategy(large_unsorted, small_unsorted) == detail::JoinStrategy::Hash);
+    }
+
+    SECTION("Hash join matches merge join") {
+        const auto hashed = detail::hash_join(Table{table1}, Table{table2});
+        const auto merged = detail::merge_join(Table{table1}, Table{table2});
+        REQUIRE(std::holds_alternative<Table>(hashed));
+        REQUIRE(std::holds_alternative<Table>(merged));
+
+        const auto& hashed_table = std::get<Table>(hashed);
+        const auto& merged_table = std::get<Table>(merged);
+        REQUIRE(hashed_table.size() == 4);
+        REQUIRE(hashed_table.get_column() == merged_table.get_column());
+        REQUIRE(to_set(hashed_table) == to_set(merged_table));
+        REQUIRE(hashed_table.get_column_value(a) == std::unordered_set<std::string>{"5", "6", "7", "8"});
+        REQUIRE(hashed_table.get_column_value(v) == std::unordered_set<std::string>{"x", "y"});
+    }
+
+    SECTION("Sort order carries over") {
+        auto merged = std::get<Table>(detail::merge_join(Table{table1}, Table{table2}));
+        auto common = std::vector<std::shared_ptr<Synonym>>{s, v};
+        std::sort(common.begin(), common.end());
+        REQUIRE(merged.is_sorted_on(common));
+
+        // Joining two sorted tables picks merge join without re-sorting
+        auto filter = Table{{s, v}};
+        filter.add_row({"2", "x"});
+        filter.add_row({"2", "y"});
+        filter.set_sort_key(common);
+        REQUIRE(detail::select_join_strategy(merged, filter) == detail::JoinStrategy::Merge);
+
+        const auto result = join(std::move(merged), std::move(filter));
+        REQUIRE(std::get<Table>(result).size() == 3);
+        REQUIRE(std::get<Table>(result).get_column_value(a) == std::unordered_set<std::string>{"5", "6", "7"});
+    }
+}
+
 TEST_CASE("Test Subtract Table") {
     auto [read_facade, write_facade] = pkb::PkbManager::create_facades();
     constexpr auto num_rows = 5;
@@ -204,6 +389,115 @@ TEST_CASE("Test Subtract Table") {
     }
 }
 
+TEST_CASE("Test Anti Join") {
+    constexpr auto num_values = 4;
+    const auto domain = [](const std::shared_ptr<Synonym>&, const std::shared_ptr<ValueDictionary>& dictionary) {
+        auto values = std::vector<ValueId>{};
+        for (auto i = 0; i < num_values; i++) {
+            values.push_back(dictionary->encode(std::to_string(i)));
+        }
+        return values;
+    };
+
+    SECTION("One synonym - complement of the domain") {
+        auto excluded = Table{{std::make_shared<AnyStmtSynonym>("s")}};
+        excluded.add_row({"1"});
+        excluded.add_row({"3"});
+
+        const auto table = anti_join(UnitTable{}, std::move(excluded), domain);
+        REQUIRE(table.get_column_value(std::make_shared<AnyStmtSynonym>("s")) ==
+                std::unordered_set<std::string>{"0", "2"});
+    }
+
+    SECTION("Two synonyms - complement of the cross product") {
+        const auto s1 = std::make_shared<AnyStmtSynonym>("s1");
+        const auto s2 = std::make_shared<AnyStmtSynonym>("s2");
+        auto excluded = Table{{s1, s2}};
+        for (auto i = 0; i < num_values; i++) {
+            excluded.add_row({std::to_string(i), std::to_string(i)});
+        }
+
+        const auto table = anti_join(UnitTable{}, std::move(excluded), domain);
+        REQUIRE(table.size() == num_values * num_values - num_values);
+        for (const auto& row : table.get_records()) {
+            REQUIRE(row[0] != row[1]);
+        }
+    }
+
+    SECTION("Rows of the left table are filtered in order") {
+        const auto s = std::make_shared<AnyStmtSynonym>("s");
+        auto table1 = Table{{s}};
+        for (auto i = 0; i < num_values; i++) {
+            table1.add_row({std::to_string(i)});
+        }
+        table1.set_sort_key({s});
+        auto excluded = Table{{s}};
+        excluded.add_row({"2"});
+
+        const auto table = anti_join(std::move(table1), std::move(excluded), domain);
+        REQUIRE(table.get_records() == std::vector<std::vector<std::string>>{{"0"}, {"1"}, {"3"}});
+        REQUIRE(table.is_sorted_on({s}));
+    }
+
+    SECTION("Rows of the left table are extended with the domain of the missing synonym") {
+        const auto s1 = std::make_shared<AnyStmtSynonym>("s1");
+        const auto s2 = std::make_shared<AnyStmtSynonym>("s2");
+        const auto excluded_pairs =
+            std::vector<std::pair<std::string, std::string>>{{"0", "1"}, {"0", "2"}, {"1", "0"}};
+        const auto expected =
+            std::vector<std::vector<std::string>>{{"0", "0"}, {"0", "3"}, {"1", "1"}, {"1", "2"}, {"1", "3"}};
+
+        auto table1 = Table{{s1}};
+        table1.add_row({"0"});
+        table1.add_row({"1"});
+        table1.set_sort_key({s1});
+
+        SECTION("Common synonym first") {
+            auto excluded = Table{{s1, s2}};
+            for (const auto& [value1, value2] : excluded_pairs) {
+                excluded.add_row({value1, value2});
+            }
+
+            const auto table = anti_join(std::move(table1), std::move(excluded), domain);
+            REQUIRE(table.get_records() == expected);
+            REQUIRE(table.get_sort_key() == Synonyms{s1});
+        }
+
+        SECTION("Common synonym second") {
+            auto excluded = Table{{s2, s1}};
+            for (const auto& [value1, value2] : excluded_pairs) {
+                excluded.add_row({value2, value1});
+            }
+
+            const auto table = anti_join(std::move(table1), std::move(excluded), domain);
+            REQUIRE(table.get_records() == expected);
+            REQUIRE(table.get_sort_key() == Synonyms{s1});
+        }
+    }
+}
+
+TEST_CASE("Test Drop Columns") {
+    const auto s1 = std::make_shared<AnyStmtSynonym>("s1");
+    const auto s2 = std::make_shared<AnyStmtSynonym>("s2");
+    auto table = Table{{s1, s2}};
+    table.add_row({"2", "3"});
+    table.add_row({"1", "3"});
+    table.add_row({"2", "4"});
+
+    SECTION("Distinct values of the remaining columns are kept") {
+        auto result = drop_columns(std::move(table), {s2});
+        const auto& remaining = std::get<Table>(result);
+        REQUIRE(remaining.get_column() == Synonyms{s1});
+        REQUIRE(remaining.size() == 2);
+        REQUIRE(remaining.get_column_value(s1) == std::unordered_set<std::string>{"1", "2"});
+        REQUIRE(remaining.is_sorted_on({s1}));
+    }
+
+    SECTION("Dropping every column leaves a unit table") {
+        REQUIRE(is_unit(drop_columns(std::move(table), {s1, s2})));
+    }
+}
+
 #ifdef ENABLE_BENCHMARK
 TEST_CASE("BENCHMARK - Merge") {
     constexpr int num_cols = 200;  // Suppose at most 200 synonyms
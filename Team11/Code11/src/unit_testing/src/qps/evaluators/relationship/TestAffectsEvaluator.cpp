@@ -170,6 +170,41 @@ TEST_CASE("Test Evaluator Affects") {
 
         REQUIRE(evaluator.evaluate(query).empty());
     }
+
+    SECTION("Evaluate - Select BOOLEAN such that Affects (s1, s2)") {
+        const auto query = Query{
+            BooleanReference{},
+            std::vector<std::shared_ptr<Clause>>{
+                std::make_shared<SuchThatClause>(
+                    Affects{std::make_shared<AnyStmtSynonym>("s1"), std::make_shared<AnyStmtSynonym>("s2")}, false),
+            },
+        };
+
+        require_equal(evaluator.evaluate(query), std::vector<std::string>{"TRUE"});
+    }
+
+    SECTION("Evaluate - Select BOOLEAN such that Affects (s1, _)") {
+        const auto query = Query{
+            BooleanReference{},
+            std::vector<std::shared_ptr<Clause>>{
+                std::make_shared<SuchThatClause>(Affects{std::make_shared<AnyStmtSynonym>("s1"), WildCard{}}, false),
+            },
+        };
+
+        require_equal(evaluator.evaluate(query), std::vector<std::string>{"TRUE"});
+    }
+
+    SECTION("Evaluate - Select BOOLEAN such that Affects (s1, s1)") {
+        const auto query = Query{
+            BooleanReference{},
+            std::vector<std::shared_ptr<Clause>>{
+                std::make_shared<SuchThatClause>(
+                    Affects{std::make_shared<AnyStmtSynonym>("s1"), std::make_shared<AnyStmtSynonym>("s1")}, false),
+            },
+        };
+
+        require_equal(evaluator.evaluate(query), std::vector<std::string>{"FALSE"});
+    }
 }
 
 TEST_CASE("Test Evaluator Affects with Cycle") {
@@ -330,6 +365,31 @@ TEST_CASE("Test Evaluator Affects with Cycle") {
 
         REQUIRE(evaluator.evaluate(query).empty());
     }
+
+    SECTION("Evaluate - Select BOOLEAN such that Affects (s1, s1)") {
+        const auto query = Query{
+            BooleanReference{},
+            std::vector<std::shared_ptr<Clause>>{
+                std::make_shared<SuchThatClause>(
+                    Affects{std::make_shared<AnyStmtSynonym>("s1"), std::make_shared<AnyStmtSynonym>("s1")}, false),
+            },
+        };
+
+        require_equal(evaluator.evaluate(query), std::vector<std::string>{"TRUE"});
+    }
+
+    SECTION("Evaluate - Select BOOLEAN such that Affects (s1, a)") {
+        // The assignments are fewer than the statements, so they are probed
+        const auto query = Query{
+            BooleanReference{},
+            std::vector<std::shared_ptr<Clause>>{
+                std::make_shared<SuchThatClause>(
+                    Affects{std::make_shared<AnyStmtSynonym>("s1"), std::make_shared<AssignSynonym>("a")}, false),
+            },
+        };
+
+        require_equal(evaluator.evaluate(query), std::vector<std::string>{"TRUE"});
+    }
 }
 
 TEST_CASE("Test Evaluator Affects with Nested Cycle") {
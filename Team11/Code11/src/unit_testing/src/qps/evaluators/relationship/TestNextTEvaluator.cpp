@@ -197,4 +197,66 @@ TEST_CASE("Test Evaluator Next* without Cycle") {
 
         require_equal(evaluator.evaluate(query), std::vector<std::string>{"1", "2"});
     }
-}
\ No newline at end of file
+}
+TEST_CASE("Test Evaluator Next* with Next* Index") {
+    const auto& [read_facade, write_facade] = PkbManager::create_facades();
+    write_facade->enable_next_star_index();
+
+    // Populate PkbManager
+    const auto assign_strs = std::vector<std::string>{"1", "2", "3", "4"};
+    for (const auto& x : assign_strs) {
+        write_facade->add_statement(x, StatementType::Assign);
+    }
+    write_facade->add_next("1", "2");
+    write_facade->add_next("2", "3");
+    write_facade->add_next("3", "2");
+    write_facade->finalise_pkb();
+
+    auto evaluator = QueryEvaluator{read_facade};
+
+    SECTION("Evaluate - Select s1 such that Next* (s1, s2)") {
+        const auto query = Query{
+            std::make_shared<AnyStmtSynonym>("s1"),
+            std::vector<std::shared_ptr<Clause>>{
+                std::make_shared<SuchThatClause>(
+                    NextT{std::make_shared<AnyStmtSynonym>("s1"), std::make_shared<AnyStmtSynonym>("s2")}, false),
+            },
+        };
+
+        require_equal(evaluator.evaluate(query), std::vector<std::string>{"1", "2", "3"});
+    }
+
+    SECTION("Evaluate - Select s1 such that Next* (s1, s1)") {
+        const auto query = Query{
+            std::make_shared<AnyStmtSynonym>("s1"),
+            std::vector<std::shared_ptr<Clause>>{
+                std::make_shared<SuchThatClause>(
+                    NextT{std::make_shared<AnyStmtSynonym>("s1"), std::make_shared<AnyStmtSynonym>("s1")}, false),
+            },
+        };
+
+        require_equal(evaluator.evaluate(query), std::vector<std::string>{"2", "3"});
+    }
+
+    SECTION("Evaluate - Select s1 such that Next* (1, s1)") {
+        const auto query = Query{
+            std::make_shared<AnyStmtSynonym>("s1"),
+            std::vector<std::shared_ptr<Clause>>{
+                std::make_shared<SuchThatClause>(NextT{Integer{"1"}, std::make_shared<AnyStmtSynonym>("s1")}, false),
+            },
+        };
+
+        require_equal(evaluator.evaluate(query), std::vector<std::string>{"2", "3"});
+    }
+
+    SECTION("Evaluate - Select s1 such that Next* (3, 3)") {
+        const auto query = Query{
+            std::make_shared<AnyStmtSynonym>("s1"),
+            std::vector<std::shared_ptr<Clause>>{
+                std::make_shared<SuchThatClause>(NextT{Integer{"3"}, Integer{"3"}}, false),
+            },
+        };
+
+        require_equal(evaluator.evaluate(query), assign_strs);
+    }
+}
@@ -0,0 +1,98 @@
+#include "catch.hpp"
+
+#include "common/statement_type.hpp"
+#include "pkb/facades/read_facade.h"
+#include "pkb/facades/write_facade.h"
+#include "pkb/pkb_manager.h"
+#include "qps/optimisers/cost.hpp"
+#include "qps/optimisers/optimiser.hpp"
+#include "qps/parser/analysers/semantic_analyser.hpp"
+#include "qps/parser/entities/primitives.hpp"
+#include "qps/parser/entities/relationship.hpp"
+#include "qps/parser/entities/synonym.hpp"
+#include <memory>
+#include <variant>
+#include <vector>
+
+using namespace qps;
+
+TEST_CASE("Test CostOptimiser - Order clauses by estimated cost") {
+    auto [read_facade, write_facade] = pkb::PkbManager::create_facades();
+
+    // 1: x = 1; 2: while (i) { 3: y = x; 4: read x; 5: x = y + x; } 6: z = x;
+    write_facade->add_procedure("main");
+    for (const auto& variable : {"x", "y", "z", "i"}) {
+        write_facade->add_variable(variable);
+    }
+    write_facade->add_statement("1", StatementType::Assign);
+    write_facade->add_statement("2", StatementType::While);
+    write_facade->add_statement("3", StatementType::Assign);
+    write_facade->add_statement("4", StatementType::Read);
+    write_facade->add_statement("5", StatementType::Assign);
+    write_facade->add_statement("6", StatementType::Assign);
+    write_facade->add_statement_modify_var("1", "x");
+    write_facade->add_statement_modify_var("2", "y");
+    write_facade->add_statement_modify_var("2", "x");
+    write_facade->add_statement_modify_var("3", "y");
+    write_facade->add_statement_modify_var("4", "x");
+    write_facade->add_statement_modify_var("5", "x");
+    write_facade->add_statement_modify_var("6", "z");
+    write_facade->add_follows("1", "2");
+    write_facade->add_follows("2", "6");
+    write_facade->add_follows("3", "4");
+    write_facade->add_follows("4", "5");
+    write_facade->add_parent("2", "3");
+    write_facade->add_parent("2", "4");
+    write_facade->add_parent("2", "5");
+    write_facade->add_next("1", "2");
+    write_facade->add_next("2", "3");
+    write_facade->add_next("3", "4");
+    write_facade->add_next("4", "5");
+    write_facade->add_next("5", "2");
+    write_facade->add_next("2", "6");
+    write_facade->finalise_pkb();
+
+    REQUIRE(read_facade->get_statement_count() == 6);
+    REQUIRE(read_facade->get_statement_count(StatementType::Assign) == 4);
+    REQUIRE(read_facade->get_variable_count() == 4);
+    REQUIRE(read_facade->get_relationship_size(RelationshipType::Follows) == 4);
+    REQUIRE(read_facade->get_relationship_size(RelationshipType::FollowsStar) == 6);
+    REQUIRE(read_facade->get_relationship_size(RelationshipType::ModifiesS) == 7);
+
+    const std::shared_ptr<Optimiser> optimiser = std::make_shared<CostOptimiser>(read_facade);
+    const auto a1 = std::make_shared<AssignSynonym>("a1");
+    const auto a2 = std::make_shared<AssignSynonym>("a2");
+    const auto s1 = std::make_shared<AnyStmtSynonym>("s1");
+    const auto s2 = std::make_shared<AnyStmtSynonym>("s2");
+
+    SECTION("Selective clauses run before computed relations") {
+        const auto affects = std::make_shared<SuchThatClause>(Affects{a1, a2}, false);
+        const auto modifies = std::make_shared<SuchThatClause>(ModifiesS{a2, QuotedIdent{"z"}}, false);
+        const auto query = Query{std::vector<Elem>{a1}, std::vector<std::shared_ptr<Clause>>{affects, modifies}};
+
+        const auto results = optimiser->optimise(std::vector<Query>{query});
+        REQUIRE(results.size() == 1);
+        REQUIRE(results[0].clauses == std::vector<std::shared_ptr<Clause>>{modifies, affects});
+    }
+
+    SECTION("Next* is deferred until its synonyms are bound") {
+        const auto next_t = std::make_shared<SuchThatClause>(NextT{s1, s2}, false);
+        const auto follows = std::make_shared<SuchThatClause>(Follows{s1, s2}, false);
+        const auto follows_t = std::make_shared<SuchThatClause>(FollowsT{s1, s2}, false);
+        const auto query =
+            Query{std::vector<Elem>{s1}, std::vector<std::shared_ptr<Clause>>{next_t, follows_t, follows}};
+
+        const auto results = optimiser->optimise(std::vector<Query>{query});
+        REQUIRE(results.size() == 1);
+        REQUIRE(results[0].clauses == std::vector<std::shared_ptr<Clause>>{follows, follows_t, next_t});
+    }
+
+    SECTION("Clauses of equal cost keep their order") {
+        const auto follows1 = std::make_shared<SuchThatClause>(Follows{s1, s2}, false);
+        const auto follows2 = std::make_shared<SuchThatClause>(Follows{s2, s1}, false);
+        const auto query = Query{std::vector<Elem>{s1}, std::vector<std::shared_ptr<Clause>>{follows1, follows2}};
+
+        const auto results = optimiser->optimise(std::vector<Query>{query});
+        REQUIRE(results[0].clauses == std::vector<std::shared_ptr<Clause>>{follows1, follows2});
+    }
+}
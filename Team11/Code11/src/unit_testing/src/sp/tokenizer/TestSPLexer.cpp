@@ -0,0 +1,72 @@
+#include "catch.hpp"
+#include "common/tokeniser/runner.hpp"
+#include "sp/tokeniser/lexer.hpp"
+#include "sp/tokeniser/tokeniser.hpp"
+
+#include <algorithm>
+
+using namespace tokenizer;
+
+namespace {
+auto same_tokens(const std::vector<Token>& lhs, const std::vector<Token>& rhs) -> bool {
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), [](const Token& a, const Token& b) {
+        return a.T == b.T && a.content == b.content;
+    });
+}
+} // namespace
+
+TEST_CASE("Test SP Lexer") {
+    const auto lexer = sp::SourceProcessorLexer();
+
+    SECTION("maximal munch - success") {
+        const auto result = lexer.tokenize("!=a");
+        REQUIRE(result.has_value());
+
+        const auto& [success, rest] = result.value();
+        REQUIRE(success.T == TokenType::NotEqual);
+        REQUIRE(success.content == "!=");
+        REQUIRE(rest == "a");
+    }
+
+    SECTION("integer without leading zero - success") {
+        const auto result = lexer.tokenize("01");
+        REQUIRE(result.has_value());
+
+        const auto& [success, rest] = result.value();
+        REQUIRE(success.T == TokenType::Integer);
+        REQUIRE(success.content == "0");
+        REQUIRE(rest == "1");
+    }
+
+    SECTION("junk run - success") {
+        const auto result = lexer.tokenize(" \t\n x");
+        REQUIRE(result.has_value());
+
+        const auto& [success, rest] = result.value();
+        REQUIRE(success.T == TokenType::Junk);
+        REQUIRE(rest == "x");
+    }
+
+    SECTION("single ampersand - failure") {
+        REQUIRE(!lexer.tokenize("&a").has_value());
+        REQUIRE(!lexer.tokenize("_").has_value());
+    }
+}
+
+TEST_CASE("Test SP Lexer matches SP Tokenizer") {
+    const auto combinator_runner = TokenizerRunner{std::make_unique<sp::SourceProcessorTokenizer>(), true};
+    const auto lexer_runner = TokenizerRunner{std::make_unique<sp::SourceProcessorLexer>(), true};
+
+    const auto source = std::string{R"(procedure main {
+        read x1;
+        y = 0 + 007 * (x1 - 120) / 3 % z;
+        while ((!(x1 >= 1)) && (y<=2) || (x1!=y)) {
+            if (x1 == 10) then { call helper; } else { print y; }
+            x1=x1-1; }
+    }
+    procedure helper { a=b>c; print a; })"};
+
+    REQUIRE(same_tokens(lexer_runner.apply_tokeniser(source), combinator_runner.apply_tokeniser(source)));
+    REQUIRE_THROWS(lexer_runner.apply_tokeniser("x = a & b;"));
+    REQUIRE_THROWS(combinator_runner.apply_tokeniser("x = a & b;"));
+}